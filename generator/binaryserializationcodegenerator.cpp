@@ -94,7 +94,9 @@ void BinarySerializationCodeGenerator::generate(ostream &os) const
         for (const clang::FriendDecl *const friendDecl : relevantClass.record->friends()) {
             // get the actual declaration which must be a function
             const clang::NamedDecl *const actualFriendDecl = friendDecl->getFriendDecl();
-            if (!actualFriendDecl || actualFriendDecl->getKind() != clang::Decl::Kind::Function) {
+            if (!actualFriendDecl
+                || (actualFriendDecl->getKind() != clang::Decl::Kind::Function
+                    && actualFriendDecl->getKind() != clang::Decl::Kind::FunctionTemplate)) {
                 continue;
             }
             // check whether the friend function matches the push/pull helper function
@@ -116,9 +118,9 @@ void BinarySerializationCodeGenerator::generate(ostream &os) const
         // print comment
         os << "// define code for (de)serializing " << relevantClass.qualifiedName << " objects\n";
 
-        // print writeCustomType method
-        os << "template <> " << visibility << " void writeCustomType<::" << relevantClass.qualifiedName
-           << ">(BinarySerializer &serializer, const ::" << relevantClass.qualifiedName
+        // print writeCustomType method; it is a template over the serializer so it covers all classes deriving from BasicBinarySerializer
+        os << "template <typename Serializer> " << visibility << " void writeCustomType(Serializer &serializer, const ::"
+           << relevantClass.qualifiedName
            << " &customObject)\n{\n"
               "    // write base classes\n";
         for (const RelevantClass *baseClass : relevantBases) {
@@ -138,8 +140,8 @@ void BinarySerializationCodeGenerator::generate(ostream &os) const
         }
 
         // print readCustomType method
-        os << "template <> " << visibility << " void readCustomType<::" << relevantClass.qualifiedName
-           << ">(BinaryDeserializer &deserializer, ::" << relevantClass.qualifiedName
+        os << "template <typename Deserializer> " << visibility << " void readCustomType(Deserializer &deserializer, ::"
+           << relevantClass.qualifiedName
            << " &customObject)\n{\n"
               "    // read base classes\n";
         for (const RelevantClass *baseClass : relevantBases) {
@@ -7,6 +7,8 @@
 #include <clang/AST/DeclTemplate.h>
 
 #include <iostream>
+#include <map>
+#include <set>
 
 using namespace std;
 using namespace CppUtilities;
@@ -32,6 +34,7 @@ JsonSerializationCodeGenerator::JsonSerializationCodeGenerator(CodeFactory &fact
 {
     m_qualifiedNameOfRecords = JsonSerializable<void>::qualifiedName;
     m_qualifiedNameOfAdaptionRecords = AdaptedJsonSerializable<void>::qualifiedName;
+    m_qualifiedNameOfEnumRecords = JsonEnumByName<void>::qualifiedName;
 }
 
 /*!
@@ -61,17 +64,94 @@ string JsonSerializationCodeGenerator::qualifiedNameIfRelevant(clang::CXXRecordD
     return string();
 }
 
+/*!
+ * \brief Prints the JsonEnumNames specialization for the specified \a relevantEnum.
+ * \remarks The name table is a perfect hash table: the seed passed to JsonReflector::enumNameHash() is searched so that all names
+ *          of the enum end up in distinct slots. This way looking up an enumerator by name takes only one string comparison.
+ */
+static void printEnumNames(ostream &os, const SerializationCodeGenerator::RelevantEnum &relevantEnum)
+{
+    // collect the names of the enumerators
+    vector<const clang::EnumConstantDecl *> enumerators;
+    for (const clang::EnumConstantDecl *enumerator : relevantEnum.enumDecl->enumerators()) {
+        enumerators.emplace_back(enumerator);
+    }
+
+    // find a table size and a seed for which the hashes of all names are distinct (doubling the table size if no seed works)
+    auto tableSize = static_cast<std::uint32_t>(1);
+    while (tableSize < enumerators.size() * 2) {
+        tableSize *= 2;
+    }
+    vector<const clang::EnumConstantDecl *> slots;
+    auto seed = static_cast<std::uint32_t>(0);
+    for (auto found = false; !found;) {
+        slots.assign(tableSize, nullptr);
+        found = true;
+        for (const clang::EnumConstantDecl *enumerator : enumerators) {
+            const auto name = enumerator->getName();
+            auto &slot = slots[JsonReflector::enumNameHash(string_view(name.data(), name.size()), seed) & (tableSize - 1)];
+            if (slot) {
+                found = false;
+                break;
+            }
+            slot = enumerator;
+        }
+        if (!found && ++seed == 1024) {
+            seed = 0;
+            tableSize *= 2;
+        }
+    }
+
+    // print comment
+    os << "// define names for (de)serializing " << relevantEnum.qualifiedName << " by name\n";
+
+    // print name function mapping each value to the name of the first enumerator with that value
+    os << "template <> struct JsonEnumNames<::" << relevantEnum.qualifiedName << "> {\n"
+       << "    static constexpr JsonMemberName name(::" << relevantEnum.qualifiedName
+       << " value)\n"
+          "    {\n"
+          "        switch (value) {\n";
+    set<std::int64_t> values;
+    for (const clang::EnumConstantDecl *enumerator : enumerators) {
+        if (!values.emplace(enumerator->getInitVal().getExtValue()).second) {
+            continue;
+        }
+        os << "        case ::" << relevantEnum.qualifiedName << "::" << enumerator->getName() << ":\n"
+           << "            return makeJsonMemberName(\"" << enumerator->getName() << "\", \"\\\"" << enumerator->getName() << "\\\"\");\n";
+    }
+    os << "        default:\n"
+          "            return JsonMemberName();\n"
+          "        }\n"
+          "    }\n";
+
+    // print perfect hash table to lookup values by name
+    os << "    static constexpr std::uint32_t hashSeed = " << seed << "u;\n"
+       << "    static constexpr std::uint32_t hashMask = " << (tableSize - 1) << "u;\n"
+       << "    static constexpr JsonEnumSlot<::" << relevantEnum.qualifiedName << "> slots[] = {\n";
+    for (const clang::EnumConstantDecl *enumerator : slots) {
+        if (enumerator) {
+            os << "        { \"" << enumerator->getName() << "\", ::" << relevantEnum.qualifiedName << "::" << enumerator->getName() << " },\n";
+        } else {
+            os << "        {},\n";
+        }
+    }
+    os << "    };\n"
+          "};\n\n";
+}
+
 /*!
  * \brief Generates pull() and push() helper functions in the ReflectiveRapidJSON::JsonReflector namespace for the relevant classes.
+ * \remarks Additionally generates the name tables for enums which are supposed to be (de)serialized by name.
  */
 void JsonSerializationCodeGenerator::generate(ostream &os) const
 {
     // initialize source manager to make use of isOnlyIncluded() for skipping records which are only included
     lazyInitializeSourceManager();
 
-    // find relevant classes
+    // find relevant classes and enums
     const auto relevantClasses = findRelevantClasses();
-    if (relevantClasses.empty()) {
+    const auto relevantEnums = findRelevantEnums();
+    if (relevantClasses.empty() && relevantEnums.empty()) {
         return; // nothing to generate
     }
 
@@ -79,6 +159,11 @@ void JsonSerializationCodeGenerator::generate(ostream &os) const
     os << "namespace ReflectiveRapidJSON {\n"
           "namespace JsonReflector {\n\n";
 
+    // add name tables for enums first so the push and pull functions for classes using them can be instantiated
+    for (const RelevantEnum *relevantEnum : relevantEnums) {
+        printEnumNames(os, *relevantEnum);
+    }
+
     // determine visibility attribute
     const char *visibility = m_options.visibilityArg.firstValue();
     if (!visibility) {
@@ -117,6 +202,8 @@ void JsonSerializationCodeGenerator::generate(ostream &os) const
         os << "// define code for (de)serializing " << relevantClass.qualifiedName << " objects\n";
 
         // print push method
+        // note: The names of the members are passed via makeJsonMemberName() so their lengths are known at compile-time. The quoted form
+        //       is used as-is by write(). Since member names are identifiers they never need to be escaped.
         os << "template <> " << visibility << " void push<::" << relevantClass.qualifiedName << ">(const ::" << relevantClass.qualifiedName
            << " &reflectable, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)\n{\n"
               "    // push base classes\n";
@@ -126,48 +213,210 @@ void JsonSerializationCodeGenerator::generate(ostream &os) const
         os << "    // push members\n";
         for (const clang::FieldDecl *field : relevantClass.record->fields()) {
             if (pushPrivateMembers || field->getAccess() == clang::AS_public) {
-                os << "    push(reflectable." << field->getName() << ", \"" << field->getName() << "\", value, allocator);\n";
+                os << "    push(reflectable." << field->getName() << ", makeJsonMemberName(\"" << field->getName() << "\", \"\\\""
+                   << field->getName() << "\\\"\"), value, allocator);\n";
             }
         }
         os << "}\n";
 
-        // skip printing the pull method for classes without default constructor because deserializing those is currently not supported
-        if (!relevantClass.record->hasDefaultConstructor()) {
-            continue;
+        // print pushDelta method
+        os << "template <> " << visibility << " void pushDelta<::" << relevantClass.qualifiedName << ">(const ::" << relevantClass.qualifiedName
+           << " &reflectable, const ::" << relevantClass.qualifiedName
+           << " &baseline, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)\n{\n"
+              "    // push differing members of base classes\n";
+        for (const RelevantClass *baseClass : relevantBases) {
+            os << "    pushDelta(static_cast<const ::" << baseClass->qualifiedName << " &>(reflectable), static_cast<const ::"
+               << baseClass->qualifiedName << " &>(baseline), value, allocator);\n";
         }
+        os << "    // push differing members\n";
+        for (const clang::FieldDecl *field : relevantClass.record->fields()) {
+            if (pushPrivateMembers || field->getAccess() == clang::AS_public) {
+                os << "    pushDelta(reflectable." << field->getName() << ", baseline." << field->getName() << ", makeJsonMemberName(\""
+                   << field->getName() << "\", \"\\\"" << field->getName() << "\\\"\"), value, allocator);\n";
+            }
+        }
+        os << "}\n";
 
-        // print pull method
-        os << "template <> " << visibility << " void pull<::" << relevantClass.qualifiedName << ">(::" << relevantClass.qualifiedName
-           << " &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, "
-              "JsonDeserializationErrors "
-              "*errors)\n{\n"
-              "    // pull base classes\n";
-        for (const RelevantClass *baseClass : relevantBases) {
-            os << "    pull(static_cast<::" << baseClass->qualifiedName << " &>(reflectable), value, errors);\n";
-        }
-        os << "    // set error context for current record\n"
-              "    const char *previousRecord;\n"
-              "    if (errors) {\n"
-              "        previousRecord = errors->currentRecord;\n"
-              "        errors->currentRecord = \""
-           << relevantClass.qualifiedName
-           << "\";\n"
-              "    }\n"
-              "    // pull members\n";
+        // group the members to be pulled by the length of their names so the generated code can dispatch members via a switch
+        // note: Printing the pull method (and the readMember and mergePatchMember methods) is skipped for classes without default
+        //       constructor because deserializing those is currently not supported.
+        const bool pullable = relevantClass.record->hasDefaultConstructor();
+        map<size_t, vector<const clang::FieldDecl *>> pullableFieldsByNameLength;
         for (const clang::FieldDecl *field : relevantClass.record->fields()) {
             // skip const members
-            if (field->getType().isConstant(field->getASTContext())) {
+            if (!pullable || field->getType().isConstant(field->getASTContext())) {
                 continue;
             }
             if (pullPrivateMembers || field->getAccess() == clang::AS_public) {
-                os << "    pull(reflectable." << field->getName() << ", \"" << field->getName() << "\", value, errors);\n";
+                pullableFieldsByNameLength[field->getName().size()].emplace_back(field);
+            }
+        }
+
+        // print pullMember and pull methods
+        // note: The pull method iterates over the object's members only once; pullMember dispatches each member to the
+        //       class or its base classes (like readMember does for read). Members of the class itself are matched first so
+        //       they take precedence over members of base classes with the same name.
+        if (pullable) {
+            os << "template <> " << visibility << " bool pullMember<::" << relevantClass.qualifiedName << ">(::" << relevantClass.qualifiedName
+               << " &reflectable, std::string_view name, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>> &value, "
+                  "JsonDeserializationErrors *errors)\n{\n"
+                  "    // set error context for current record\n"
+                  "    const char *previousRecord;\n"
+                  "    if (errors) {\n"
+                  "        previousRecord = errors->currentRecord;\n"
+                  "        errors->currentRecord = \""
+               << relevantClass.qualifiedName
+               << "\";\n"
+                  "    }\n"
+                  "    // pull member with matching name (dispatching by the length of the name and the name itself)\n"
+                  "    auto found = true;\n"
+                  "    switch (name.size()) {\n";
+            for (const auto &[nameLength, fields] : pullableFieldsByNameLength) {
+                os << "    case " << nameLength << ":\n";
+                for (const clang::FieldDecl *field : fields) {
+                    os << (field == fields.front() ? "        if" : " else if") << " (name == \"" << field->getName()
+                       << "\") {\n            pull(reflectable." << field->getName() << ", \"" << field->getName() << "\", value, errors);\n        }";
+                }
+                os << " else {\n"
+                      "            found = false;\n"
+                      "        }\n"
+                      "        break;\n";
+            }
+            os << "    default:\n"
+                  "        found = false;\n"
+                  "    }\n"
+                  "    // restore error context for previous record\n"
+                  "    if (errors) {\n"
+                  "        errors->currentRecord = previousRecord;\n"
+                  "    }\n";
+            if (relevantBases.empty()) {
+                os << "    return found;\n";
+            } else {
+                os << "    if (found) {\n"
+                      "        return true;\n"
+                      "    }\n"
+                      "    // pull members of base classes (unless shadowed by a member of the class itself)\n";
+                for (const RelevantClass *baseClass : relevantBases) {
+                    os << "    if (pullMember(static_cast<::" << baseClass->qualifiedName
+                       << " &>(reflectable), name, value, errors)) {\n"
+                          "        return true;\n"
+                          "    }\n";
+                }
+                os << "    return false;\n";
+            }
+            os << "}\n";
+            os << "template <> " << visibility << " void pull<::" << relevantClass.qualifiedName << ">(::" << relevantClass.qualifiedName
+               << " &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, "
+                  "JsonDeserializationErrors "
+                  "*errors)\n{\n"
+                  "    // pull members of the class and its base classes: iterate over the object's members only once (if a member occurs\n"
+                  "    // multiple times, the last occurrence wins)\n"
+                  "    for (const auto &member : value) {\n"
+                  "        pullMember(reflectable, std::string_view(member.name.GetString(), member.name.GetStringLength()), member.value, errors);\n"
+                  "    }\n"
+                  "}\n";
+        }
+
+        // print JsonMembers specialization providing the writeMembers and writeMembersWithoutDefaults methods and - for classes with
+        // default constructor - the readMember and mergePatchMember methods; those are templated on the writer/reader so all flags of
+        // the policy can be used
+        os << "template <> struct JsonMembers<::" << relevantClass.qualifiedName << "> {\n";
+        os << "    template <typename Writer> static void writeMembers(const ::" << relevantClass.qualifiedName
+           << " &reflectable, Writer &writer)\n    {\n"
+              "        // write base classes\n";
+        for (const RelevantClass *baseClass : relevantBases) {
+            os << "        JsonMembers<::" << baseClass->qualifiedName << ">::writeMembers(static_cast<const ::" << baseClass->qualifiedName
+               << " &>(reflectable), writer);\n";
+        }
+        os << "        // write members\n";
+        for (const clang::FieldDecl *field : relevantClass.record->fields()) {
+            if (pushPrivateMembers || field->getAccess() == clang::AS_public) {
+                os << "        write(reflectable." << field->getName() << ", makeJsonMemberName(\"" << field->getName() << "\", \"\\\""
+                   << field->getName() << "\\\"\"), writer);\n";
+            }
+        }
+        os << "    }\n";
+        os << "\n    template <typename Writer>\n    static void writeMembersWithoutDefaults(const ::" << relevantClass.qualifiedName
+           << " &reflectable, const ::" << relevantClass.qualifiedName
+           << " &defaults, Writer &writer)\n    {\n"
+              "        // write base classes\n";
+        for (const RelevantClass *baseClass : relevantBases) {
+            os << "        JsonMembers<::" << baseClass->qualifiedName << ">::writeMembersWithoutDefaults(static_cast<const ::"
+               << baseClass->qualifiedName << " &>(reflectable), static_cast<const ::" << baseClass->qualifiedName << " &>(defaults), writer);\n";
+        }
+        os << "        // write members differing from their default value\n";
+        for (const clang::FieldDecl *field : relevantClass.record->fields()) {
+            if (pushPrivateMembers || field->getAccess() == clang::AS_public) {
+                os << "        writeWithoutDefault(reflectable." << field->getName() << ", defaults." << field->getName()
+                   << ", makeJsonMemberName(\"" << field->getName() << "\", \"\\\"" << field->getName() << "\\\"\"), writer);\n";
+            }
+        }
+        os << "    }\n";
+
+        if (pullable) {
+            // print readMember and mergePatchMember methods which only differ in the function used to read the matching member
+            static constexpr const char *readFunctions[][3] = {
+                { "readMember", "read", "read" },
+                { "mergePatchMember", "mergePatch", "apply merge patch for" },
+            };
+            for (const auto &[functionName, memberFunctionName, description] : readFunctions) {
+                os << "\n    template <typename Reader>\n    static bool " << functionName << "(::" << relevantClass.qualifiedName
+                   << " &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)\n    {\n"
+                   << "        // set error context for current record (only maintained if the reader tracks the context of errors)\n"
+                      "        const char *previousRecord;\n"
+                      "        if constexpr (Reader::tracksErrorContext) {\n"
+                      "            if (errors) {\n"
+                      "                previousRecord = errors->currentRecord;\n"
+                      "                errors->currentRecord = \""
+                   << relevantClass.qualifiedName
+                   << "\";\n"
+                      "            }\n"
+                      "        }\n"
+                   << "        // " << description << " member with matching name (dispatching by the length of the name and the name itself)\n"
+                   << "        auto found = true;\n"
+                      "        switch (name.size()) {\n";
+                for (const auto &[nameLength, fields] : pullableFieldsByNameLength) {
+                    os << "        case " << nameLength << ":\n";
+                    for (const clang::FieldDecl *field : fields) {
+                        os << (field == fields.front() ? "            if" : " else if") << " (name == \"" << field->getName()
+                           << "\") {\n                " << memberFunctionName << "(reflectable." << field->getName() << ", \"" << field->getName()
+                           << "\", reader, errors);\n            }";
+                    }
+                    os << " else {\n"
+                          "                found = false;\n"
+                          "            }\n"
+                          "            break;\n";
+                }
+                os << "        default:\n"
+                      "            found = false;\n"
+                      "        }\n";
+                os << "        // restore error context for previous record\n"
+                      "        if constexpr (Reader::tracksErrorContext) {\n"
+                      "            if (errors) {\n"
+                      "                errors->currentRecord = previousRecord;\n"
+                      "            }\n"
+                      "        }\n";
+                if (relevantBases.empty()) {
+                    os << "        return found;\n";
+                } else {
+                    os << "        if (found) {\n"
+                          "            return true;\n"
+                          "        }\n"
+                       << "        // " << description << " members of base classes (unless shadowed by a member of the class itself)\n";
+                    for (const RelevantClass *baseClass : relevantBases) {
+                        os << "        if (JsonMembers<::" << baseClass->qualifiedName << ">::" << functionName << "(static_cast<::"
+                           << baseClass->qualifiedName << " &>(reflectable), name, reader, errors)) {\n"
+                              "            return true;\n"
+                              "        }\n";
+                    }
+                    os << "        return false;\n";
+                }
+                os << "    }\n";
             }
         }
-        os << "    // restore error context for previous record\n"
-              "    if (errors) {\n"
-              "        errors->currentRecord = previousRecord;\n"
-              "    }\n";
-        os << "}\n\n";
+        os << "};\n"
+              "template <> struct HasJsonMembers<::"
+           << relevantClass.qualifiedName << "> : public Traits::Bool<true> {};\n\n";
     }
 
     // close namespace ReflectiveRapidJSON::JsonReflector
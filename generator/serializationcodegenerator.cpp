@@ -5,6 +5,7 @@
 #include <clang/AST/DeclCXX.h>
 #include <clang/AST/DeclFriend.h>
 #include <clang/AST/DeclTemplate.h>
+#include <clang/AST/Type.h>
 
 #include <iostream>
 
@@ -23,6 +24,7 @@ ostream &operator<<(ostream &os, llvm::StringRef str)
 /*!
  * \brief Adds all class declarations (to the internal member variable m_records).
  * \remarks "AdaptedXXXSerializable" specializations are directly filtered and added to m_adaptionRecords (instead of m_records).
+ *          Likewise, specializations marking an enum to be serialized by name (e.g. "JsonEnumByName") are added to m_enumRecords.
  */
 void SerializationCodeGenerator::addDeclaration(clang::Decl *decl)
 {
@@ -56,12 +58,28 @@ void SerializationCodeGenerator::addDeclaration(clang::Decl *decl)
             }
         }
 
+        // check for template specializations to serialize an enum by name
+        if (m_qualifiedNameOfEnumRecords && decl->getKind() == clang::Decl::Kind::ClassTemplateSpecialization) {
+            auto *const templateSpecializationRecord = static_cast<clang::ClassTemplateSpecializationDecl *>(decl);
+            if (templateSpecializationRecord->getQualifiedNameAsString() == m_qualifiedNameOfEnumRecords) {
+                // get the enum the template argument refers to (exactly one argument expected)
+                const auto &templateArgs = templateSpecializationRecord->getTemplateArgs();
+                if (templateArgs.size() != 1 || templateArgs.get(0).getKind() != clang::TemplateArgument::Type) {
+                    return; // FIXME: use Clang diagnostics to print warning
+                }
+                const auto *const enumType = templateArgs.get(0).getAsType()->getAs<clang::EnumType>();
+                if (!enumType) {
+                    return; // FIXME: use Clang diagnostics to print warning
+                }
+                auto *const enumDecl = enumType->getDecl();
+                m_enumRecords.emplace_back(enumDecl->getQualifiedNameAsString(), enumDecl, templateSpecializationRecord);
+                return;
+            }
+        }
+
         // add any other records
         m_records.emplace_back(record);
     } break;
-    case clang::Decl::Kind::Enum:
-        // TODO: add enums
-        break;
     default:;
     }
 }
@@ -110,6 +128,21 @@ std::vector<SerializationCodeGenerator::RelevantClass> SerializationCodeGenerato
     return relevantClasses;
 }
 
+/*!
+ * \brief Returns the enums which have been marked to be serialized by name within the files the code is generated for.
+ */
+std::vector<const SerializationCodeGenerator::RelevantEnum *> SerializationCodeGenerator::findRelevantEnums() const
+{
+    std::vector<const RelevantEnum *> relevantEnums;
+    for (const RelevantEnum &enumRecord : m_enumRecords) {
+        // skip all enums which are only marked within included files
+        if (!isOnlyIncluded(enumRecord.record)) {
+            relevantEnums.emplace_back(&enumRecord);
+        }
+    }
+    return relevantEnums;
+}
+
 std::vector<const SerializationCodeGenerator::RelevantClass *> SerializationCodeGenerator::findRelevantBaseClasses(
     const SerializationCodeGenerator::RelevantClass &relevantClass, const std::vector<SerializationCodeGenerator::RelevantClass> &relevantBases)
 {
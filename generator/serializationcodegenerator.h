@@ -22,6 +22,14 @@ public:
         clang::CXXRecordDecl *record;
     };
 
+    struct RelevantEnum {
+        explicit RelevantEnum(std::string &&qualifiedName, clang::EnumDecl *enumDecl, clang::CXXRecordDecl *record);
+
+        std::string qualifiedName;
+        clang::EnumDecl *enumDecl;
+        clang::CXXRecordDecl *record;
+    };
+
     SerializationCodeGenerator(CodeFactory &factory);
 
     void addDeclaration(clang::Decl *decl) override;
@@ -31,16 +39,19 @@ protected:
     IsRelevant isQualifiedNameIfRelevant(clang::CXXRecordDecl *record, const std::string &qualifiedName) const;
     virtual std::string qualifiedNameIfRelevant(clang::CXXRecordDecl *record) const = 0;
     std::vector<RelevantClass> findRelevantClasses() const;
+    std::vector<const RelevantEnum *> findRelevantEnums() const;
     static std::vector<const RelevantClass *> findRelevantBaseClasses(
         const RelevantClass &relevantClass, const std::vector<RelevantClass> &relevantBases);
 
 protected:
     const char *m_qualifiedNameOfRecords;
     const char *m_qualifiedNameOfAdaptionRecords;
+    const char *m_qualifiedNameOfEnumRecords;
 
 private:
     std::vector<clang::CXXRecordDecl *> m_records;
     std::vector<RelevantClass> m_adaptionRecords;
+    std::vector<RelevantEnum> m_enumRecords;
 };
 
 inline SerializationCodeGenerator::RelevantClass::RelevantClass(std::string &&qualifiedName, clang::CXXRecordDecl *record)
@@ -49,10 +60,18 @@ inline SerializationCodeGenerator::RelevantClass::RelevantClass(std::string &&qu
 {
 }
 
+inline SerializationCodeGenerator::RelevantEnum::RelevantEnum(std::string &&qualifiedName, clang::EnumDecl *enumDecl, clang::CXXRecordDecl *record)
+    : qualifiedName(qualifiedName)
+    , enumDecl(enumDecl)
+    , record(record)
+{
+}
+
 inline SerializationCodeGenerator::SerializationCodeGenerator(CodeFactory &factory)
     : CodeGenerator(factory)
     , m_qualifiedNameOfRecords(nullptr)
     , m_qualifiedNameOfAdaptionRecords(nullptr)
+    , m_qualifiedNameOfEnumRecords(nullptr)
 {
 }
 
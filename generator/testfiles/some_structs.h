@@ -16,6 +16,14 @@ struct Person : public ReflectiveRapidJSON::JsonSerializable<Person>
     bool alive;
 };
 
+enum class Mood
+{
+    Happy,
+    Sad,
+    Indifferent,
+    Meh = Indifferent,
+};
+
 struct NonReflectableClass
 {
     int foo;
@@ -28,6 +36,8 @@ struct SomeOtherNonReflectableClass : public NonReflectableClass
 
 }
 
+REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME(TestNamespace1::Mood);
+
 namespace TestNamespace2 {
 
 struct ThirdPartyStruct {
@@ -1,57 +1,333 @@
 namespace ReflectiveRapidJSON {
 namespace JsonReflector {
 
+// define names for (de)serializing TestNamespace1::Mood by name
+template <> struct JsonEnumNames<::TestNamespace1::Mood> {
+    static constexpr JsonMemberName name(::TestNamespace1::Mood value)
+    {
+        switch (value) {
+        case ::TestNamespace1::Mood::Happy:
+            return makeJsonMemberName("Happy", "\"Happy\"");
+        case ::TestNamespace1::Mood::Sad:
+            return makeJsonMemberName("Sad", "\"Sad\"");
+        case ::TestNamespace1::Mood::Indifferent:
+            return makeJsonMemberName("Indifferent", "\"Indifferent\"");
+        default:
+            return JsonMemberName();
+        }
+    }
+    static constexpr std::uint32_t hashSeed = 0u;
+    static constexpr std::uint32_t hashMask = 7u;
+    static constexpr JsonEnumSlot<::TestNamespace1::Mood> slots[] = {
+        { "Sad", ::TestNamespace1::Mood::Sad },
+        {},
+        {},
+        {},
+        { "Happy", ::TestNamespace1::Mood::Happy },
+        { "Indifferent", ::TestNamespace1::Mood::Indifferent },
+        {},
+        { "Meh", ::TestNamespace1::Mood::Meh },
+    };
+};
+
 // define code for (de)serializing TestNamespace1::Person objects
 template <>  void push<::TestNamespace1::Person>(const ::TestNamespace1::Person &reflectable, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
 {
     // push base classes
     // push members
-    push(reflectable.age, "age", value, allocator);
-    push(reflectable.alive, "alive", value, allocator);
+    push(reflectable.age, makeJsonMemberName("age", "\"age\""), value, allocator);
+    push(reflectable.alive, makeJsonMemberName("alive", "\"alive\""), value, allocator);
 }
-template <>  void pull<::TestNamespace1::Person>(::TestNamespace1::Person &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, JsonDeserializationErrors *errors)
+template <>  void pushDelta<::TestNamespace1::Person>(const ::TestNamespace1::Person &reflectable, const ::TestNamespace1::Person &baseline, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    // push differing members of base classes
+    // push differing members
+    pushDelta(reflectable.age, baseline.age, makeJsonMemberName("age", "\"age\""), value, allocator);
+    pushDelta(reflectable.alive, baseline.alive, makeJsonMemberName("alive", "\"alive\""), value, allocator);
+}
+template <>  bool pullMember<::TestNamespace1::Person>(::TestNamespace1::Person &reflectable, std::string_view name, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
 {
-    // pull base classes
     // set error context for current record
     const char *previousRecord;
     if (errors) {
         previousRecord = errors->currentRecord;
         errors->currentRecord = "TestNamespace1::Person";
     }
-    // pull members
-    pull(reflectable.age, "age", value, errors);
-    pull(reflectable.alive, "alive", value, errors);
+    // pull member with matching name (dispatching by the length of the name and the name itself)
+    auto found = true;
+    switch (name.size()) {
+    case 3:
+        if (name == "age") {
+            pull(reflectable.age, "age", value, errors);
+        } else {
+            found = false;
+        }
+        break;
+    case 5:
+        if (name == "alive") {
+            pull(reflectable.alive, "alive", value, errors);
+        } else {
+            found = false;
+        }
+        break;
+    default:
+        found = false;
+    }
     // restore error context for previous record
     if (errors) {
         errors->currentRecord = previousRecord;
     }
+    return found;
+}
+template <>  void pull<::TestNamespace1::Person>(::TestNamespace1::Person &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, JsonDeserializationErrors *errors)
+{
+    // pull members of the class and its base classes: iterate over the object's members only once (if a member occurs
+    // multiple times, the last occurrence wins)
+    for (const auto &member : value) {
+        pullMember(reflectable, std::string_view(member.name.GetString(), member.name.GetStringLength()), member.value, errors);
+    }
 }
+template <> struct JsonMembers<::TestNamespace1::Person> {
+    template <typename Writer> static void writeMembers(const ::TestNamespace1::Person &reflectable, Writer &writer)
+    {
+        // write base classes
+        // write members
+        write(reflectable.age, makeJsonMemberName("age", "\"age\""), writer);
+        write(reflectable.alive, makeJsonMemberName("alive", "\"alive\""), writer);
+    }
+
+    template <typename Writer>
+    static void writeMembersWithoutDefaults(const ::TestNamespace1::Person &reflectable, const ::TestNamespace1::Person &defaults, Writer &writer)
+    {
+        // write base classes
+        // write members differing from their default value
+        writeWithoutDefault(reflectable.age, defaults.age, makeJsonMemberName("age", "\"age\""), writer);
+        writeWithoutDefault(reflectable.alive, defaults.alive, makeJsonMemberName("alive", "\"alive\""), writer);
+    }
+
+    template <typename Reader>
+    static bool readMember(::TestNamespace1::Person &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        // set error context for current record (only maintained if the reader tracks the context of errors)
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestNamespace1::Person";
+            }
+        }
+        // read member with matching name (dispatching by the length of the name and the name itself)
+        auto found = true;
+        switch (name.size()) {
+        case 3:
+            if (name == "age") {
+                read(reflectable.age, "age", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        case 5:
+            if (name == "alive") {
+                read(reflectable.alive, "alive", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        default:
+            found = false;
+        }
+        // restore error context for previous record
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(::TestNamespace1::Person &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        // set error context for current record (only maintained if the reader tracks the context of errors)
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestNamespace1::Person";
+            }
+        }
+        // apply merge patch for member with matching name (dispatching by the length of the name and the name itself)
+        auto found = true;
+        switch (name.size()) {
+        case 3:
+            if (name == "age") {
+                mergePatch(reflectable.age, "age", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        case 5:
+            if (name == "alive") {
+                mergePatch(reflectable.alive, "alive", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        default:
+            found = false;
+        }
+        // restore error context for previous record
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+};
+template <> struct HasJsonMembers<::TestNamespace1::Person> : public Traits::Bool<true> {};
 
 // define code for (de)serializing TestNamespace2::ThirdPartyStruct objects
 template <>  void push<::TestNamespace2::ThirdPartyStruct>(const ::TestNamespace2::ThirdPartyStruct &reflectable, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
 {
     // push base classes
     // push members
-    push(reflectable.test1, "test1", value, allocator);
-    push(reflectable.test2, "test2", value, allocator);
+    push(reflectable.test1, makeJsonMemberName("test1", "\"test1\""), value, allocator);
+    push(reflectable.test2, makeJsonMemberName("test2", "\"test2\""), value, allocator);
 }
-template <>  void pull<::TestNamespace2::ThirdPartyStruct>(::TestNamespace2::ThirdPartyStruct &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, JsonDeserializationErrors *errors)
+template <>  void pushDelta<::TestNamespace2::ThirdPartyStruct>(const ::TestNamespace2::ThirdPartyStruct &reflectable, const ::TestNamespace2::ThirdPartyStruct &baseline, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    // push differing members of base classes
+    // push differing members
+    pushDelta(reflectable.test1, baseline.test1, makeJsonMemberName("test1", "\"test1\""), value, allocator);
+    pushDelta(reflectable.test2, baseline.test2, makeJsonMemberName("test2", "\"test2\""), value, allocator);
+}
+template <>  bool pullMember<::TestNamespace2::ThirdPartyStruct>(::TestNamespace2::ThirdPartyStruct &reflectable, std::string_view name, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
 {
-    // pull base classes
     // set error context for current record
     const char *previousRecord;
     if (errors) {
         previousRecord = errors->currentRecord;
         errors->currentRecord = "TestNamespace2::ThirdPartyStruct";
     }
-    // pull members
-    pull(reflectable.test1, "test1", value, errors);
-    pull(reflectable.test2, "test2", value, errors);
+    // pull member with matching name (dispatching by the length of the name and the name itself)
+    auto found = true;
+    switch (name.size()) {
+    case 5:
+        if (name == "test1") {
+            pull(reflectable.test1, "test1", value, errors);
+        } else if (name == "test2") {
+            pull(reflectable.test2, "test2", value, errors);
+        } else {
+            found = false;
+        }
+        break;
+    default:
+        found = false;
+    }
     // restore error context for previous record
     if (errors) {
         errors->currentRecord = previousRecord;
     }
+    return found;
+}
+template <>  void pull<::TestNamespace2::ThirdPartyStruct>(::TestNamespace2::ThirdPartyStruct &reflectable, const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value, JsonDeserializationErrors *errors)
+{
+    // pull members of the class and its base classes: iterate over the object's members only once (if a member occurs
+    // multiple times, the last occurrence wins)
+    for (const auto &member : value) {
+        pullMember(reflectable, std::string_view(member.name.GetString(), member.name.GetStringLength()), member.value, errors);
+    }
 }
+template <> struct JsonMembers<::TestNamespace2::ThirdPartyStruct> {
+    template <typename Writer> static void writeMembers(const ::TestNamespace2::ThirdPartyStruct &reflectable, Writer &writer)
+    {
+        // write base classes
+        // write members
+        write(reflectable.test1, makeJsonMemberName("test1", "\"test1\""), writer);
+        write(reflectable.test2, makeJsonMemberName("test2", "\"test2\""), writer);
+    }
+
+    template <typename Writer>
+    static void writeMembersWithoutDefaults(const ::TestNamespace2::ThirdPartyStruct &reflectable, const ::TestNamespace2::ThirdPartyStruct &defaults, Writer &writer)
+    {
+        // write base classes
+        // write members differing from their default value
+        writeWithoutDefault(reflectable.test1, defaults.test1, makeJsonMemberName("test1", "\"test1\""), writer);
+        writeWithoutDefault(reflectable.test2, defaults.test2, makeJsonMemberName("test2", "\"test2\""), writer);
+    }
+
+    template <typename Reader>
+    static bool readMember(::TestNamespace2::ThirdPartyStruct &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        // set error context for current record (only maintained if the reader tracks the context of errors)
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestNamespace2::ThirdPartyStruct";
+            }
+        }
+        // read member with matching name (dispatching by the length of the name and the name itself)
+        auto found = true;
+        switch (name.size()) {
+        case 5:
+            if (name == "test1") {
+                read(reflectable.test1, "test1", reader, errors);
+            } else if (name == "test2") {
+                read(reflectable.test2, "test2", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        default:
+            found = false;
+        }
+        // restore error context for previous record
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(::TestNamespace2::ThirdPartyStruct &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        // set error context for current record (only maintained if the reader tracks the context of errors)
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestNamespace2::ThirdPartyStruct";
+            }
+        }
+        // apply merge patch for member with matching name (dispatching by the length of the name and the name itself)
+        auto found = true;
+        switch (name.size()) {
+        case 5:
+            if (name == "test1") {
+                mergePatch(reflectable.test1, "test1", reader, errors);
+            } else if (name == "test2") {
+                mergePatch(reflectable.test2, "test2", reader, errors);
+            } else {
+                found = false;
+            }
+            break;
+        default:
+            found = false;
+        }
+        // restore error context for previous record
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+};
+template <> struct HasJsonMembers<::TestNamespace2::ThirdPartyStruct> : public Traits::Bool<true> {};
 
 } // namespace JsonReflector
 } // namespace ReflectiveRapidJSON
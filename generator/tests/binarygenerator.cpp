@@ -14,9 +14,12 @@
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 using namespace CPPUNIT_NS;
 using namespace CppUtilities;
@@ -64,6 +67,24 @@ void BinaryGeneratorTests::testSerializationAndDeserialization()
     CPPUNIT_ASSERT_EQUAL(obj.someSize, deserializedObj.someSize);
     CPPUNIT_ASSERT_EQUAL(obj.someString, deserializedObj.someString);
     CPPUNIT_ASSERT_EQUAL(obj.someBool, deserializedObj.someBool);
+
+    // serializing into a buffer yields the same and can be deserialized as well
+    vector<std::byte> buffer;
+    static_cast<BinarySerializable<DerivedTestStruct> &>(obj).toBinary(buffer);
+    const auto streamContents = stream.str();
+    CPPUNIT_ASSERT_EQUAL(streamContents.size(), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), streamContents.cbegin(),
+        [](std::byte byte, char expectedByte) { return to_integer<char>(byte) == expectedByte; }));
+    const auto objFromBuffer(BinarySerializable<DerivedTestStruct>::fromBinary(buffer.data(), buffer.size()));
+    CPPUNIT_ASSERT_EQUAL(obj.someInt, objFromBuffer.someInt);
+    CPPUNIT_ASSERT_EQUAL(obj.someSize, objFromBuffer.someSize);
+    CPPUNIT_ASSERT_EQUAL(obj.someString, objFromBuffer.someString);
+    CPPUNIT_ASSERT_EQUAL(obj.someBool, objFromBuffer.someBool);
+
+    // the size is known upfront (the generated writeCustomType() covers the counting serializer as well)
+    const auto &serializable = static_cast<const BinarySerializable<DerivedTestStruct> &>(obj);
+    CPPUNIT_ASSERT_EQUAL(buffer.size(), serializable.binarySize());
+    CPPUNIT_ASSERT_EQUAL(buffer.size() + 4, serializable.binarySize(ReflectiveRapidJSON::BinaryReflector::BinaryFormat::LittleEndian));
 }
 
 /*!
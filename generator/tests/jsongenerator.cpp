@@ -31,7 +31,9 @@ class JsonGeneratorTests : public TestFixture {
     CPPUNIT_TEST(testNesting);
     CPPUNIT_TEST(testSingleInheritence);
     CPPUNIT_TEST(testMultipleInheritence);
+    CPPUNIT_TEST(testShadowedMembers);
     CPPUNIT_TEST(testCustomSerialization);
+    CPPUNIT_TEST(testEnumsByName);
     CPPUNIT_TEST(test3rdPartyAdaption);
     CPPUNIT_TEST(testHandlingConstMembers);
     CPPUNIT_TEST_SUITE_END();
@@ -44,7 +46,9 @@ public:
     void testNesting();
     void testSingleInheritence();
     void testMultipleInheritence();
+    void testShadowedMembers();
     void testCustomSerialization();
+    void testEnumsByName();
     void test3rdPartyAdaption();
     void testHandlingConstMembers();
 
@@ -55,7 +59,7 @@ private:
 CPPUNIT_TEST_SUITE_REGISTRATION(JsonGeneratorTests);
 
 JsonGeneratorTests::JsonGeneratorTests()
-    : m_expectedCode(toArrayOfLines(readFile(testFilePath("some_structs_json_serialization.h"), 3 * 1024)))
+    : m_expectedCode(toArrayOfLines(readFile(testFilePath("some_structs_json_serialization.h"), 16 * 1024)))
 {
 }
 
@@ -160,6 +164,14 @@ void JsonGeneratorTests::testNesting()
     CPPUNIT_ASSERT_EQUAL(test.someString, parsedTest.someString);
     CPPUNIT_ASSERT_EQUAL(test.yetAnotherString, parsedTest.yetAnotherString);
     CPPUNIT_ASSERT_EQUAL(3.14, parsedNested.deq.front());
+
+    // test deserialization without intermediate document
+    const NestedTestStruct parsedNestedSax(NestedTestStruct::fromJsonSax(expectedJSON));
+    CPPUNIT_ASSERT_EQUAL(1_st, parsedNestedSax.nested.size());
+    CPPUNIT_ASSERT_EQUAL(1_st, parsedNestedSax.nested.front().size());
+    CPPUNIT_ASSERT_EQUAL(1_st, parsedNestedSax.deq.size());
+    CPPUNIT_ASSERT_EQUAL(test.someString, parsedNestedSax.nested.front().front().someString);
+    CPPUNIT_ASSERT_EQUAL(3.14, parsedNestedSax.deq.front());
 }
 
 /*!
@@ -189,6 +201,22 @@ void JsonGeneratorTests::testSingleInheritence()
     CPPUNIT_ASSERT_EQUAL(test.someString, parsedTest.someString);
     CPPUNIT_ASSERT_EQUAL(test.yetAnotherString, parsedTest.yetAnotherString);
     CPPUNIT_ASSERT_EQUAL(test.someBool, parsedTest.someBool);
+
+    // test deserializing members (of the derived and the base class) which occur multiple times: the last occurrence wins
+    const string jsonWithDuplicates("{\"someInt\":1,\"someBool\":true,\"someInt\":2,\"someBool\":false}");
+    const auto parsedDuplicates = JsonSerializable<DerivedTestStruct>::fromJson(jsonWithDuplicates);
+    CPPUNIT_ASSERT_EQUAL(2, parsedDuplicates.someInt);
+    CPPUNIT_ASSERT_EQUAL(false, parsedDuplicates.someBool);
+    const auto parsedDuplicatesSax = JsonSerializable<DerivedTestStruct>::fromJsonSax(jsonWithDuplicates);
+    CPPUNIT_ASSERT_EQUAL(2, parsedDuplicatesSax.someInt);
+    CPPUNIT_ASSERT_EQUAL(false, parsedDuplicatesSax.someBool);
+
+    // test serializing only the members differing from a baseline (including members of the base class)
+    DerivedTestStruct changedTest(test);
+    changedTest.someString = "changed";
+    changedTest.someBool = true;
+    CPPUNIT_ASSERT_EQUAL(string("{\"someString\":\"changed\",\"someBool\":true}"),
+        string(ReflectiveRapidJSON::JsonReflector::toJsonDelta(changedTest, test).GetString()));
 }
 
 /*!
@@ -218,6 +246,49 @@ void JsonGeneratorTests::testMultipleInheritence()
     CPPUNIT_ASSERT_EQUAL(test.yetAnotherString, parsedTest.yetAnotherString);
     CPPUNIT_ASSERT_EQUAL(test.someBool, parsedTest.someBool);
     CPPUNIT_ASSERT_EQUAL(test.arrayOfStrings, parsedTest.arrayOfStrings);
+
+    // test deserialization without intermediate document (members of base classes are dispatched via JsonMembers::readMember() of the bases)
+    const MultipleDerivedTestStruct parsedTestSax(JsonSerializable<MultipleDerivedTestStruct>::fromJsonSax(expectedJSONForDerived));
+    CPPUNIT_ASSERT_EQUAL(test.someInt, parsedTestSax.someInt);
+    CPPUNIT_ASSERT_EQUAL(test.someSize, parsedTestSax.someSize);
+    CPPUNIT_ASSERT_EQUAL(test.yetAnotherString, parsedTestSax.yetAnotherString);
+    CPPUNIT_ASSERT_EQUAL(test.someBool, parsedTestSax.someBool);
+    CPPUNIT_ASSERT_EQUAL(test.arrayOfStrings, parsedTestSax.arrayOfStrings);
+
+    // test applying a merge patch touching members of the class itself and its bases
+    ReflectiveRapidJSON::JsonReflector::applyMergePatch(test, string("{\"someInt\":43,\"yetAnotherString\":null,\"arrayOfStrings\":[\"patched\"]}"));
+    CPPUNIT_ASSERT_EQUAL(43, test.someInt);
+    CPPUNIT_ASSERT_EQUAL(string(), test.yetAnotherString);
+    CPPUNIT_ASSERT_EQUAL(vector<string>{ "patched" }, test.arrayOfStrings);
+    CPPUNIT_ASSERT_EQUAL(string("the answer"), test.someString);
+}
+
+/*!
+ * \brief Tests whether a member shadowing a member of a base class takes precedence when deserializing.
+ */
+void JsonGeneratorTests::testShadowedMembers()
+{
+    ShadowingTestStruct test;
+    const string expectedJSON("{\"someInt\":0,\"someSize\":1,\"someString\":\"foo\",\"yetAnotherString\":\"bar\",\"someString\":\"shadowing\"}");
+
+    // test serialization (members of base classes are written first)
+    CPPUNIT_ASSERT_EQUAL(expectedJSON, string(as<ShadowingTestStruct>(test).toJson().GetString()));
+
+    // test deserialization via pull() and read(); the member of the class itself is filled
+    const string json("{\"someInt\":42,\"someString\":\"derived\"}");
+    const ShadowingTestStruct parsedTest(JsonSerializable<ShadowingTestStruct>::fromJson(json));
+    CPPUNIT_ASSERT_EQUAL(42, parsedTest.someInt);
+    CPPUNIT_ASSERT_EQUAL(string("derived"), parsedTest.someString);
+    CPPUNIT_ASSERT_EQUAL(string("foo"), static_cast<const TestStruct &>(parsedTest).someString);
+    const ShadowingTestStruct parsedTestSax(JsonSerializable<ShadowingTestStruct>::fromJsonSax(json));
+    CPPUNIT_ASSERT_EQUAL(42, parsedTestSax.someInt);
+    CPPUNIT_ASSERT_EQUAL(string("derived"), parsedTestSax.someString);
+    CPPUNIT_ASSERT_EQUAL(string("foo"), static_cast<const TestStruct &>(parsedTestSax).someString);
+
+    // test applying a merge patch
+    ReflectiveRapidJSON::JsonReflector::applyMergePatch(test, string("{\"someString\":\"patched\"}"));
+    CPPUNIT_ASSERT_EQUAL(string("patched"), test.someString);
+    CPPUNIT_ASSERT_EQUAL(string("foo"), static_cast<const TestStruct &>(test).someString);
 }
 
 /*!
@@ -237,6 +308,39 @@ void JsonGeneratorTests::testCustomSerialization()
     CPPUNIT_ASSERT_EQUAL(test.ts.toString(), parsedTest.ts.toString());
 }
 
+/*!
+ * \brief Tests whether enums marked via REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME are (de)serialized by name.
+ */
+void JsonGeneratorTests::testEnumsByName()
+{
+    const StructWithEnums test;
+    const string str("{\"color\":\"Green\",\"colors\":[\"Blue\",\"Red\"]}");
+
+    // test serialization
+    CPPUNIT_ASSERT_EQUAL(str, string(test.toJson().GetString()));
+
+    // test deserialization
+    const StructWithEnums parsedTest(StructWithEnums::fromJson(str));
+    CPPUNIT_ASSERT(parsedTest.color == Color::Green);
+    CPPUNIT_ASSERT(parsedTest.colors == test.colors);
+
+    // test numbers (written for values without name) being accepted as well
+    JsonDeserializationErrors errors;
+    const StructWithEnums numericTest(StructWithEnums::fromJson(string("{\"color\":2,\"colors\":[1]}"), &errors));
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT(numericTest.color == Color::Blue);
+    CPPUNIT_ASSERT(numericTest.colors == vector<Color>{ Color::Green });
+
+    // test unknown names and other types
+    const StructWithEnums invalidTest(StructWithEnums::fromJson(string("{\"color\":\"Purple\",\"colors\":[true]}"), &errors));
+    CPPUNIT_ASSERT_EQUAL(2_st, errors.size());
+    CPPUNIT_ASSERT(errors.front().kind == JsonDeserializationErrorKind::ConversionError);
+    CPPUNIT_ASSERT(errors.front().expectedType == JsonType::String);
+    CPPUNIT_ASSERT(errors.back().kind == JsonDeserializationErrorKind::TypeMismatch);
+    CPPUNIT_ASSERT(errors.back().actualType == JsonType::Bool);
+    CPPUNIT_ASSERT(invalidTest.color == Color::Green);
+}
+
 /*!
  * \brief Tests whether adapting (de)serialization for 3rd party structs works.
  */
@@ -76,6 +76,15 @@ struct DerivedTestStruct : public TestStruct, public JsonSerializable<DerivedTes
     bool someBool = true;
 };
 
+/*!
+ * \brief The ShadowingTestStruct struct declares a member with the same name as a member of its base class. The member
+ *        of the class itself is supposed to take precedence when deserializing. This is asserted in
+ *        JsonGeneratorTests::testShadowedMembers();
+ */
+struct ShadowingTestStruct : public TestStruct, public JsonSerializable<ShadowingTestStruct> {
+    string someString = "shadowing";
+};
+
 /*!
  * \brief The NonSerializable struct should be ignored when used as base class because it isn't serializable.
  */
@@ -103,6 +112,22 @@ struct StructWithCustomTypes : public JsonSerializable<StructWithCustomTypes> {
     CppUtilities::TimeSpan ts = CppUtilities::TimeSpan::fromHours(3.25) + CppUtilities::TimeSpan::fromSeconds(19.125);
 };
 
+/*!
+ * \brief The Color enum is (de)serialized by name. This is asserted in JsonGeneratorTests::testEnumsByName().
+ */
+enum class Color { Red, Green, Blue };
+
+REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME(Color);
+
+/*!
+ * \brief The StructWithEnums struct inherits from JsonSerializable and should hence have functional fromJson()
+ *        and toJson() methods. This is asserted in JsonGeneratorTests::testEnumsByName();
+ */
+struct StructWithEnums : public JsonSerializable<StructWithEnums> {
+    Color color = Color::Green;
+    vector<Color> colors = { Color::Blue, Color::Red };
+};
+
 /*!
  * \brief The NotJsonSerializable struct is used to test (de)serialization for 3rd party structs (which do not
  *        inherit from JsonSerializable instance). It is used in JsonGeneratorTests::test3rdPartyAdaption().
@@ -24,13 +24,15 @@
 namespace ReflectiveRapidJSON {
 namespace BinaryReflector {
 
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> *> void readCustomType(BinaryDeserializer &deserializer, Type &customType)
+template <typename Type, typename Deserializer, Traits::EnableIf<IsCustomType<Type>> *>
+void readCustomType(Deserializer &deserializer, Type &customType)
 {
     boost::hana::for_each(
         boost::hana::keys(customType), [&deserializer, &customType](auto key) { deserializer.read(boost::hana::at_key(customType, key)); });
 }
 
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> *> void writeCustomType(BinarySerializer &serializer, const Type &customType)
+template <typename Type, typename Serializer, Traits::EnableIf<IsCustomType<Type>> *>
+void writeCustomType(Serializer &serializer, const Type &customType)
 {
     boost::hana::for_each(
         boost::hana::keys(customType), [&serializer, &customType](auto key) { serializer.write(boost::hana::at_key(customType, key)); });
@@ -16,22 +16,22 @@
 namespace ReflectiveRapidJSON {
 namespace BinaryReflector {
 
-template <> inline void readCustomType<CppUtilities::DateTime>(BinaryDeserializer &deserializer, CppUtilities::DateTime &dateTime)
+template <typename Deserializer> inline void readCustomType(Deserializer &deserializer, CppUtilities::DateTime &dateTime)
 {
     deserializer.read(dateTime.ticks());
 }
 
-template <> inline void writeCustomType<CppUtilities::DateTime>(BinarySerializer &serializer, const CppUtilities::DateTime &dateTime)
+template <typename Serializer> inline void writeCustomType(Serializer &serializer, const CppUtilities::DateTime &dateTime)
 {
     serializer.write(dateTime.totalTicks());
 }
 
-template <> inline void readCustomType<CppUtilities::TimeSpan>(BinaryDeserializer &deserializer, CppUtilities::TimeSpan &timeSpan)
+template <typename Deserializer> inline void readCustomType(Deserializer &deserializer, CppUtilities::TimeSpan &timeSpan)
 {
     deserializer.read(timeSpan.ticks());
 }
 
-template <> inline void writeCustomType<CppUtilities::TimeSpan>(BinarySerializer &serializer, const CppUtilities::TimeSpan &timeSpan)
+template <typename Serializer> inline void writeCustomType(Serializer &serializer, const CppUtilities::TimeSpan &timeSpan)
 {
     serializer.write(timeSpan.totalTicks());
 }
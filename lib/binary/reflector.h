@@ -9,15 +9,22 @@
 
 #include "../traits.h"
 
+#include <c++utilities/conversion/binaryconversion.h>
 #include <c++utilities/conversion/conversionexception.h>
 #include <c++utilities/io/binaryreader.h>
 #include <c++utilities/io/binarywriter.h>
 
+#include <algorithm>
 #include <any>
+#include <array>
+#include <cstddef>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <variant>
+#include <vector>
 
 /// \cond
 class BinaryReflectorTests;
@@ -40,6 +47,16 @@ template <typename Type> struct BinarySerializable;
  */
 namespace BinaryReflector {
 
+/*!
+ * \brief The BinaryFormat enum specifies the byte order of multi-byte numbers within the binary representation.
+ * \remarks Variable-length integers (used for sizes) and big pointer IDs are always big-endian as their byte order is part
+ *          of the encoding.
+ */
+enum class BinaryFormat : std::uint8_t {
+    BigEndian, /**< big-endian without header (the default, compatible with data serialized by previous versions) */
+    LittleEndian, /**< little-endian, preceded by a header (so data can be copied as-is on little-endian hosts) */
+};
+
 // define traits to distinguish between "built-in" types like int, std::string, std::vector, ... and custom structs/classes
 template <typename Type>
 using IsBuiltInType = Traits::Any<Traits::IsAnyOf<Type, char, std::uint8_t, bool, std::string, std::int16_t, std::uint16_t, std::int32_t,
@@ -47,90 +64,443 @@ using IsBuiltInType = Traits::Any<Traits::IsAnyOf<Type, char, std::uint8_t, bool
     Traits::IsIteratable<Type>, Traits::IsSpecializingAnyOf<Type, std::pair, std::unique_ptr, std::shared_ptr>, std::is_enum<Type>, IsVariant<Type>>;
 template <typename Type> using IsCustomType = Traits::Not<IsBuiltInType<Type>>;
 
+/// \cond
+namespace Detail {
+template <typename Type, typename = void>
+struct HasFixedSizeWireRepresentation : public Traits::IsAnyOf<Type, char, std::uint8_t, std::int16_t, std::uint16_t, std::int32_t, std::uint32_t,
+                                            std::int64_t, std::uint64_t, float, double> {
+};
+template <typename Type>
+struct HasFixedSizeWireRepresentation<Type, std::enable_if_t<std::is_enum_v<Type>>>
+    : public HasFixedSizeWireRepresentation<std::underlying_type_t<Type>> {
+};
+template <typename Type> struct IsStdArray : public Traits::Bool<false> {
+};
+template <typename Element, std::size_t size> struct IsStdArray<std::array<Element, size>> : public Traits::Bool<true> {
+};
+template <typename Type, typename = void> struct IsContiguousNumberRange : public Traits::Bool<false> {
+};
+template <typename Type>
+struct IsContiguousNumberRange<Type, std::enable_if_t<Traits::IsSpecializationOf<Type, std::vector>::value || IsStdArray<Type>::value>>
+    : public HasFixedSizeWireRepresentation<typename Type::value_type> {
+};
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief The IsContiguousNumberRange class checks whether \tparam Type stores numbers (or enums) contiguously so it can be
+ *        (de)serialized as a whole instead of element by element.
+ * \remarks Covers std::vector (except std::vector<bool> which is not an actual container of bool) and std::array.
+ */
+template <typename Type> using IsContiguousNumberRange = Detail::IsContiguousNumberRange<Type>;
+
+/// \cond
+namespace Detail {
+#ifdef CONVERSION_UTILITIES_IS_BYTE_ORDER_LITTLE_ENDIAN
+inline constexpr auto hostFormat = BinaryFormat::LittleEndian;
+#else
+inline constexpr auto hostFormat = BinaryFormat::BigEndian;
+#endif
+inline constexpr char littleEndianHeader[] = { 'R', 'R', 'J', 'L' };
+
+template <std::size_t size> struct UnsignedIntegerOfSize {
+};
+template <> struct UnsignedIntegerOfSize<2> {
+    using type = std::uint16_t;
+};
+template <> struct UnsignedIntegerOfSize<4> {
+    using type = std::uint32_t;
+};
+template <> struct UnsignedIntegerOfSize<8> {
+    using type = std::uint64_t;
+};
+
+/*!
+ * \brief Returns the number of bytes required to write \a value as variable-length integer.
+ * \throws Throws a CppUtilities::ConversionException if \a value exceeds the maximum (2^56 - 1).
+ */
+inline std::size_t variableLengthUIntSize(std::uint64_t value)
+{
+    auto boundCheck = std::uint64_t(0x80);
+    auto prefixLength = std::size_t(1);
+    while (prefixLength <= 8 && value >= boundCheck) {
+        boundCheck <<= 7;
+        ++prefixLength;
+    }
+    if (prefixLength > 8) {
+        throw CppUtilities::ConversionException("The variable-length integer to be written exceeds the maximum.");
+    }
+    return prefixLength;
+}
+
+/*!
+ * \brief Returns \a number with reversed byte order.
+ */
+template <typename Number> inline Number swapByteOrder(Number number)
+{
+    typename UnsignedIntegerOfSize<sizeof(Number)>::type value;
+    std::memcpy(&value, &number, sizeof(Number));
+    value = CppUtilities::swapOrder(value);
+    std::memcpy(&number, &value, sizeof(Number));
+    return number;
+}
+
+/*!
+ * \brief Reverses the byte order of the specified \a elements in-place.
+ * \remarks This is a plain loop of byte-swaps which compilers vectorize.
+ */
+template <typename Element> inline void swapByteOrder(Element *elements, std::size_t count)
+{
+    for (auto *const end = elements + count; elements != end; ++elements) {
+        *elements = swapByteOrder(*elements);
+    }
+}
+
+/*!
+ * \brief Writes the specified \a elements with reversed byte order to \a bytes.
+ */
+template <typename Element> inline void copyWithSwappedByteOrder(const Element *elements, std::size_t count, char *bytes)
+{
+    for (const auto *const end = elements + count; elements != end; ++elements, bytes += sizeof(Element)) {
+        const auto swapped = swapByteOrder(*elements);
+        std::memcpy(bytes, &swapped, sizeof(Element));
+    }
+}
+} // namespace Detail
+/// \endcond
+
 class BinaryDeserializer;
 class BinarySerializer;
+class BufferDeserializer;
+class BufferSerializer;
+class CountingSerializer;
 
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> * = nullptr> void readCustomType(BinaryDeserializer &deserializer, Type &customType);
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> * = nullptr> void writeCustomType(BinarySerializer &serializer, const Type &customType);
+/*!
+ * \brief Reads the \a customType via the specified \a deserializer.
+ * \remarks The \tparam Deserializer is one of the classes deriving from BasicBinaryDeserializer. So one definition covers all of
+ *          them. Definitions for specific types are provided as overloads like
+ *          `template <typename Deserializer> void readCustomType(Deserializer &deserializer, SomeType &customType)` by the code
+ *          generator or by hand. A generic definition is provided by reflector-boosthana.h.
+ */
+template <typename Type, typename Deserializer, Traits::EnableIf<IsCustomType<Type>> * = nullptr>
+void readCustomType(Deserializer &deserializer, Type &customType);
 
-class BinaryDeserializer : public CppUtilities::BinaryReader {
+/*!
+ * \brief Writes the \a customType via the specified \a serializer.
+ * \remarks The \tparam Serializer is one of the classes deriving from BasicBinarySerializer (see readCustomType() for details).
+ */
+template <typename Type, typename Serializer, Traits::EnableIf<IsCustomType<Type>> * = nullptr>
+void writeCustomType(Serializer &serializer, const Type &customType);
+
+/*!
+ * \brief The BasicBinaryDeserializer class implements deserializing types composed of other types (containers, pointers, variants,
+ *        enums and custom types).
+ * \remarks The \tparam Derived class needs to provide read() for primitive types and raw bytes as well as readByte(), readBool(),
+ *          readUInt64BE() and readVariableLengthUIntBE().
+ */
+template <typename Derived> class BasicBinaryDeserializer {
     friend class ::BinaryReflectorTests;
 
 public:
-    explicit BinaryDeserializer(std::istream *stream);
-
-    using CppUtilities::BinaryReader::read;
     template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr> void read(Type &pair);
     template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> * = nullptr> void read(Type &pointer);
     template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> * = nullptr> void read(Type &pointer);
-    template <typename Type, Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>> * = nullptr> void read(Type &iteratable);
+    template <typename Type, Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>, Traits::Not<IsContiguousNumberRange<Type>>> * = nullptr>
+    void read(Type &iteratable);
+    template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>, Traits::IsResizable<Type>> * = nullptr> void read(Type &iteratable);
+    template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>, Traits::Not<Traits::IsResizable<Type>>> * = nullptr>
+    void read(Type &iteratable);
     template <typename Type, Traits::EnableIfAny<IsMapOrHash<Type>, IsMultiMapOrHash<Type>> * = nullptr> void read(Type &iteratable);
     template <typename Type,
         Traits::EnableIf<IsIteratableExceptString<Type>,
-            Traits::None<IsMapOrHash<Type>, IsMultiMapOrHash<Type>, Traits::All<IsArray<Type>, Traits::IsResizable<Type>>>> * = nullptr>
+            Traits::None<IsMapOrHash<Type>, IsMultiMapOrHash<Type>, Traits::All<IsArray<Type>, Traits::IsResizable<Type>>,
+                IsContiguousNumberRange<Type>>> * = nullptr>
     void read(Type &iteratable);
     template <typename Type, Traits::EnableIf<std::is_enum<Type>> * = nullptr> void read(Type &enumValue);
     template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr> void read(Type &variant);
     template <typename Type, Traits::EnableIf<IsCustomType<Type>> * = nullptr> void read(Type &customType);
+    void readHeader();
+
+    BinaryFormat format() const;
+
+protected:
+    explicit BasicBinaryDeserializer(BinaryFormat format);
 
 private:
+    Derived &derived();
+    template <typename Element> std::size_t readContiguousRangeSize();
+    template <typename Element> void readContiguousRange(Element *elements, std::size_t size);
+
     std::unordered_map<std::uint64_t, std::any> m_pointer;
+    const BinaryFormat m_format;
 };
 
-class BinarySerializer : public CppUtilities::BinaryWriter {
+/*!
+ * \brief The BasicBinarySerializer class implements serializing types composed of other types (containers, pointers, variants,
+ *        enums and custom types).
+ * \remarks The \tparam Derived class needs to provide write() for primitive types and raw bytes as well as writeByte(), writeBool(),
+ *          writeUInt64BE() and writeVariableLengthUIntBE().
+ */
+template <typename Derived> class BasicBinarySerializer {
     friend class ::BinaryReflectorTests;
 
 public:
-    explicit BinarySerializer(std::ostream *stream);
-
-    using CppUtilities::BinaryWriter::write;
     template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr> void write(const Type &pair);
     template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::unique_ptr>> * = nullptr> void write(const Type &pointer);
     template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::shared_ptr>> * = nullptr> void write(const Type &pointer);
-    template <typename Type, Traits::EnableIf<IsIteratableExceptString<Type>, Traits::HasSize<Type>> * = nullptr> void write(const Type &iteratable);
+    template <typename Type,
+        Traits::EnableIf<IsIteratableExceptString<Type>, Traits::HasSize<Type>, Traits::Not<IsContiguousNumberRange<Type>>> * = nullptr>
+    void write(const Type &iteratable);
+    template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>> * = nullptr> void write(const Type &iteratable);
     template <typename Type, Traits::EnableIf<std::is_enum<Type>> * = nullptr> void write(const Type &enumValue);
     template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr> void write(const Type &variant);
     template <typename Type, Traits::EnableIf<IsCustomType<Type>> * = nullptr> void write(const Type &customType);
+    void writeHeader();
+
+    BinaryFormat format() const;
+
+protected:
+    explicit BasicBinarySerializer(BinaryFormat format);
 
 private:
+    Derived &derived();
+
     std::unordered_map<std::uint64_t, bool> m_pointer;
+    const BinaryFormat m_format;
 };
 
-inline BinaryDeserializer::BinaryDeserializer(std::istream *stream)
-    : CppUtilities::BinaryReader(stream)
+/*!
+ * \brief The BinaryDeserializer class deserializes from an std::istream.
+ */
+class BinaryDeserializer : public CppUtilities::BinaryReader, public BasicBinaryDeserializer<BinaryDeserializer> {
+public:
+    explicit BinaryDeserializer(std::istream *stream, BinaryFormat format = BinaryFormat::BigEndian);
+
+    using CppUtilities::BinaryReader::read;
+    using BasicBinaryDeserializer<BinaryDeserializer>::read;
+    void read(std::string_view &value);
+    void read(std::int16_t &value);
+    void read(std::uint16_t &value);
+    void read(std::int32_t &value);
+    void read(std::uint32_t &value);
+    void read(std::int64_t &value);
+    void read(std::uint64_t &value);
+    void read(float &value);
+    void read(double &value);
+};
+
+/*!
+ * \brief The BinarySerializer class serializes to an std::ostream.
+ */
+class BinarySerializer : public CppUtilities::BinaryWriter, public BasicBinarySerializer<BinarySerializer> {
+public:
+    explicit BinarySerializer(std::ostream *stream, BinaryFormat format = BinaryFormat::BigEndian);
+
+    using CppUtilities::BinaryWriter::write;
+    using BasicBinarySerializer<BinarySerializer>::write;
+    void write(std::int16_t value);
+    void write(std::uint16_t value);
+    void write(std::int32_t value);
+    void write(std::uint32_t value);
+    void write(std::int64_t value);
+    void write(std::uint64_t value);
+    void write(float value);
+    void write(double value);
+};
+
+/*!
+ * \brief The BufferDeserializer class deserializes from a contiguous buffer.
+ * \remarks
+ * - Produces the same results as the BinaryDeserializer but accesses the buffer directly instead of going through an std::istream.
+ *   The buffer can be any contiguous memory, e.g. a memory-mapped file.
+ * - The buffer is not copied so it must stay valid as long as the deserializer is used.
+ * - Strings deserialized into std::string_view are not copied either. They reference the buffer directly so the buffer must stay
+ *   valid (and unmodified) as long as these views are used. Everything else is copied into the deserialized objects.
+ * - Throws a CppUtilities::ConversionException when the end of the buffer is reached unexpectedly.
+ */
+class BufferDeserializer : public BasicBinaryDeserializer<BufferDeserializer> {
+public:
+    explicit BufferDeserializer(const std::byte *data, std::size_t size, BinaryFormat format = BinaryFormat::BigEndian);
+    explicit BufferDeserializer(const std::vector<std::byte> &buffer, BinaryFormat format = BinaryFormat::BigEndian);
+
+    using BasicBinaryDeserializer<BufferDeserializer>::read;
+    void read(char *buffer, std::streamsize length);
+    void read(char &value);
+    void read(std::uint8_t &value);
+    void read(bool &value);
+    void read(std::string &value);
+    void read(std::string_view &value);
+    void read(std::int16_t &value);
+    void read(std::uint16_t &value);
+    void read(std::int32_t &value);
+    void read(std::uint32_t &value);
+    void read(std::int64_t &value);
+    void read(std::uint64_t &value);
+    void read(float &value);
+    void read(double &value);
+    std::uint8_t readByte();
+    bool readBool();
+    std::uint64_t readUInt64BE();
+    std::uint64_t readVariableLengthUIntBE();
+    std::string readLengthPrefixedString();
+
+    const std::byte *position() const;
+    std::size_t bytesLeft() const;
+
+private:
+    const char *consume(std::size_t count);
+    template <typename Number> Number readNumber();
+
+    const std::byte *m_position;
+    const std::byte *const m_end;
+};
+
+/*!
+ * \brief The BufferSerializer class serializes by appending to an std::vector<std::byte>.
+ * \remarks Produces the same results as the BinarySerializer but writes to the buffer directly instead of going through an std::ostream.
+ */
+class BufferSerializer : public BasicBinarySerializer<BufferSerializer> {
+public:
+    explicit BufferSerializer(std::vector<std::byte> *buffer, BinaryFormat format = BinaryFormat::BigEndian);
+
+    using BasicBinarySerializer<BufferSerializer>::write;
+    void write(const char *buffer, std::streamsize length);
+    void write(char value);
+    void write(std::uint8_t value);
+    void write(bool value);
+    void write(const std::string &value);
+    void write(std::string_view value);
+    void write(std::int16_t value);
+    void write(std::uint16_t value);
+    void write(std::int32_t value);
+    void write(std::uint32_t value);
+    void write(std::int64_t value);
+    void write(std::uint64_t value);
+    void write(float value);
+    void write(double value);
+    void writeByte(std::uint8_t value);
+    void writeBool(bool value);
+    void writeUInt64BE(std::uint64_t value);
+    void writeVariableLengthUIntBE(std::uint64_t value);
+    void writeLengthPrefixedString(std::string_view value);
+
+    std::vector<std::byte> &buffer();
+
+private:
+    void append(const char *buffer, std::size_t length);
+    template <typename Number> void writeNumber(Number value);
+
+    std::vector<std::byte> &m_buffer;
+};
+
+/*!
+ * \brief The CountingSerializer class determines the size of the binary representation without actually writing it.
+ * \remarks The size equals the number of bytes the BinarySerializer and the BufferSerializer would write. The header is not
+ *          taken into account because it is only written explicitly via writeHeader(). Use binarySize() for convenience.
+ */
+class CountingSerializer : public BasicBinarySerializer<CountingSerializer> {
+public:
+    explicit CountingSerializer();
+
+    using BasicBinarySerializer<CountingSerializer>::write;
+    void write(const char *buffer, std::streamsize length);
+    void write(char value);
+    void write(std::uint8_t value);
+    void write(bool value);
+    void write(const std::string &value);
+    void write(std::string_view value);
+    void write(std::int16_t value);
+    void write(std::uint16_t value);
+    void write(std::int32_t value);
+    void write(std::uint32_t value);
+    void write(std::int64_t value);
+    void write(std::uint64_t value);
+    void write(float value);
+    void write(double value);
+    void writeByte(std::uint8_t value);
+    void writeBool(bool value);
+    void writeUInt64BE(std::uint64_t value);
+    void writeVariableLengthUIntBE(std::uint64_t value);
+    void writeLengthPrefixedString(std::string_view value);
+
+    std::size_t size() const;
+
+private:
+    std::size_t m_size;
+};
+
+template <typename Derived>
+inline BasicBinaryDeserializer<Derived>::BasicBinaryDeserializer(BinaryFormat format)
+    : m_format(format)
+{
+}
+
+template <typename Derived> inline Derived &BasicBinaryDeserializer<Derived>::derived()
+{
+    return static_cast<Derived &>(*this);
+}
+
+/*!
+ * \brief Returns the format the deserializer expects.
+ */
+template <typename Derived> inline BinaryFormat BasicBinaryDeserializer<Derived>::format() const
+{
+    return m_format;
+}
+
+/*!
+ * \brief Reads the header written by BasicBinarySerializer::writeHeader() if the format requires one.
+ * \throws Throws a CppUtilities::ConversionException if the header does not denote the expected format.
+ * \remarks Only the little-endian format has a header. So reading little-endian data as big-endian is not detected.
+ */
+template <typename Derived> void BasicBinaryDeserializer<Derived>::readHeader()
 {
+    if (m_format != BinaryFormat::LittleEndian) {
+        return;
+    }
+    char header[sizeof(Detail::littleEndianHeader)];
+    derived().read(header, static_cast<std::streamsize>(sizeof(header)));
+    if (std::memcmp(header, Detail::littleEndianHeader, sizeof(header))) {
+        throw CppUtilities::ConversionException("Header does not denote the little-endian binary format");
+    }
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *> void BinaryDeserializer::read(Type &pair)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &pair)
 {
-    read(pair.first);
-    read(pair.second);
+    derived().read(pair.first);
+    derived().read(pair.second);
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> *> void BinaryDeserializer::read(Type &pointer)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &pointer)
 {
-    if (!readBool()) {
+    if (!derived().readBool()) {
         pointer.reset();
         return;
     }
     pointer = std::make_unique<typename Type::element_type>();
-    read(*pointer);
+    derived().read(*pointer);
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> *> void BinaryDeserializer::read(Type &pointer)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &pointer)
 {
-    auto mode = readByte();
+    auto mode = derived().readByte();
     if (!mode) {
         // pointer not set
         pointer.reset();
         return;
     }
 
-    const auto id = (mode & 0x4) ? readUInt64BE() : readVariableLengthUIntBE(); // the 3rd bit being flagged indicates a big ID
+    const auto id = (mode & 0x4) ? derived().readUInt64BE() : derived().readVariableLengthUIntBE(); // the 3rd bit being flagged indicates a big ID
     if ((mode & 0x3) == 1) {
         // first occurence: make a new pointer
         m_pointer[id] = pointer = std::make_shared<typename Type::element_type>();
-        read(*pointer);
+        derived().read(*pointer);
         return;
     }
     // further occurences: copy previous pointer
@@ -141,49 +511,119 @@ template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::
     }
 }
 
-template <typename Type, Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>> *> void BinaryDeserializer::read(Type &iteratable)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>, Traits::Not<IsContiguousNumberRange<Type>>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &iteratable)
 {
-    const auto size = readVariableLengthUIntBE();
+    const auto size = derived().readVariableLengthUIntBE();
     iteratable.resize(size);
     for (auto &element : iteratable) {
-        read(element);
+        derived().read(element);
     }
 }
 
-template <typename Type, Traits::EnableIfAny<IsMapOrHash<Type>, IsMultiMapOrHash<Type>> *> void BinaryDeserializer::read(Type &iteratable)
+/*!
+ * \brief Reads the size of a contiguous range of numbers.
+ * \throws Throws a CppUtilities::ConversionException if the size exceeds the maximum or, when reading from a buffer, the
+ *         number of bytes left. So a corrupted size does not lead to a huge allocation.
+ */
+template <typename Derived> template <typename Element> std::size_t BasicBinaryDeserializer<Derived>::readContiguousRangeSize()
 {
-    const auto size = readVariableLengthUIntBE();
+    const auto size = derived().readVariableLengthUIntBE();
+    if (size > std::numeric_limits<std::size_t>::max() / sizeof(Element)) {
+        throw CppUtilities::ConversionException("Size of range exceeds maximum.");
+    }
+    if constexpr (std::is_same_v<Derived, BufferDeserializer>) {
+        if (size * sizeof(Element) > derived().bytesLeft()) {
+            throw CppUtilities::ConversionException("Size of range exceeds the end of the buffer.");
+        }
+    }
+    return static_cast<std::size_t>(size);
+}
+
+/*!
+ * \brief Reads the specified number of \a elements at once and converts the byte order afterwards if it differs from the host's.
+ */
+template <typename Derived>
+template <typename Element>
+void BasicBinaryDeserializer<Derived>::readContiguousRange(Element *elements, std::size_t size)
+{
+    derived().read(reinterpret_cast<char *>(elements), static_cast<std::streamsize>(size * sizeof(Element)));
+    if constexpr (sizeof(Element) > 1) {
+        if (m_format != Detail::hostFormat) {
+            Detail::swapByteOrder(elements, size);
+        }
+    }
+}
+
+/*!
+ * \brief Reads a contiguous range of numbers at once.
+ * \remarks Produces the same result as reading element by element.
+ */
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>, Traits::IsResizable<Type>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &iteratable)
+{
+    using Element = typename Type::value_type;
+    iteratable.resize(readContiguousRangeSize<Element>());
+    readContiguousRange(iteratable.data(), iteratable.size());
+}
+
+/*!
+ * \brief Reads a contiguous range of numbers with fixed size (std::array) at once.
+ * \throws Throws a CppUtilities::ConversionException if the size of the range does not match the size of \a iteratable.
+ */
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>, Traits::Not<Traits::IsResizable<Type>>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &iteratable)
+{
+    using Element = typename Type::value_type;
+    if (readContiguousRangeSize<Element>() != iteratable.size()) {
+        throw CppUtilities::ConversionException("Size of range does not match the size of the array.");
+    }
+    readContiguousRange(iteratable.data(), iteratable.size());
+}
+
+template <typename Derived>
+template <typename Type, Traits::EnableIfAny<IsMapOrHash<Type>, IsMultiMapOrHash<Type>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &iteratable)
+{
+    const auto size = derived().readVariableLengthUIntBE();
     for (size_t i = 0; i != size; ++i) {
         std::pair<typename std::remove_const<typename Type::value_type::first_type>::type, typename Type::value_type::second_type> value;
-        read(value);
+        derived().read(value);
         iteratable.emplace(std::move(value));
     }
 }
 
+template <typename Derived>
 template <typename Type,
     Traits::EnableIf<IsIteratableExceptString<Type>,
-        Traits::None<IsMapOrHash<Type>, IsMultiMapOrHash<Type>, Traits::All<IsArray<Type>, Traits::IsResizable<Type>>>> *>
-void BinaryDeserializer::read(Type &iteratable)
+        Traits::None<IsMapOrHash<Type>, IsMultiMapOrHash<Type>, Traits::All<IsArray<Type>, Traits::IsResizable<Type>>,
+            IsContiguousNumberRange<Type>>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &iteratable)
 {
-    const auto size = readVariableLengthUIntBE();
+    const auto size = derived().readVariableLengthUIntBE();
     for (size_t i = 0; i != size; ++i) {
         typename Type::value_type value;
-        read(value);
+        derived().read(value);
         iteratable.emplace(std::move(value));
     }
 }
 
-template <typename Type, Traits::EnableIf<std::is_enum<Type>> *> void BinaryDeserializer::read(Type &enumValue)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<std::is_enum<Type>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &enumValue)
 {
     typename std::underlying_type<Type>::type value;
-    read(value);
+    derived().read(value);
     enumValue = static_cast<Type>(value);
 }
 
 /// \cond
 namespace Detail {
-template <typename Variant, std::size_t compiletimeIndex = 0>
-void readVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant, BinaryDeserializer &deserializer)
+template <typename Variant, std::size_t compiletimeIndex = 0, typename Deserializer>
+void readVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant, Deserializer &deserializer)
 {
     if constexpr (compiletimeIndex < std::variant_size_v<Variant>) {
         if (compiletimeIndex == runtimeIndex) {
@@ -202,40 +642,75 @@ void readVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant,
 } // namespace Detail
 /// \endcond
 
-template <typename Type, Traits::EnableIf<IsVariant<Type>> *> void BinaryDeserializer::read(Type &variant)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsVariant<Type>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &variant)
 {
-    Detail::readVariantValueByRuntimeIndex(readByte(), variant, *this);
+    Detail::readVariantValueByRuntimeIndex(derived().readByte(), variant, derived());
 }
 
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> *> void BinaryDeserializer::read(Type &customType)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsCustomType<Type>> *>
+void BasicBinaryDeserializer<Derived>::read(Type &customType)
 {
-    readCustomType(*this, customType);
+    readCustomType(derived(), customType);
 }
 
-inline BinarySerializer::BinarySerializer(std::ostream *stream)
-    : CppUtilities::BinaryWriter(stream)
+template <typename Derived>
+inline BasicBinarySerializer<Derived>::BasicBinarySerializer(BinaryFormat format)
+    : m_format(format)
+{
+}
+
+template <typename Derived> inline Derived &BasicBinarySerializer<Derived>::derived()
 {
+    return static_cast<Derived &>(*this);
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *> void BinarySerializer::write(const Type &pair)
+/*!
+ * \brief Returns the format the serializer produces.
+ */
+template <typename Derived> inline BinaryFormat BasicBinarySerializer<Derived>::format() const
 {
-    write(pair.first);
-    write(pair.second);
+    return m_format;
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::unique_ptr>> *> void BinarySerializer::write(const Type &pointer)
+/*!
+ * \brief Writes the header denoting the format if the format requires one.
+ * \remarks Only the little-endian format has a header so data in the default format stays compatible with previous versions.
+ */
+template <typename Derived> void BasicBinarySerializer<Derived>::writeHeader()
+{
+    if (m_format == BinaryFormat::LittleEndian) {
+        derived().write(Detail::littleEndianHeader, static_cast<std::streamsize>(sizeof(Detail::littleEndianHeader)));
+    }
+}
+
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *>
+void BasicBinarySerializer<Derived>::write(const Type &pair)
+{
+    derived().write(pair.first);
+    derived().write(pair.second);
+}
+
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::unique_ptr>> *>
+void BasicBinarySerializer<Derived>::write(const Type &pointer)
 {
     const bool hasValue = pointer != nullptr;
-    writeBool(hasValue);
+    derived().writeBool(hasValue);
     if (hasValue) {
-        write(*pointer);
+        derived().write(*pointer);
     }
 }
 
-template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::shared_ptr>> *> void BinarySerializer::write(const Type &pointer)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std::shared_ptr>> *>
+void BasicBinarySerializer<Derived>::write(const Type &pointer)
 {
     if (pointer == nullptr) {
-        writeByte(0);
+        derived().writeByte(0);
         return;
     }
     const auto id = reinterpret_cast<std::uintptr_t>(pointer.get());
@@ -245,40 +720,69 @@ template <typename Type, Traits::EnableIf<Traits::IsSpecializingAnyOf<Type, std:
     if (bigId) {
         mode = mode | 0x4; // "flag" 3rd bit to indicate big ID
     }
-    writeByte(mode);
+    derived().writeByte(mode);
     if (bigId) {
-        writeUInt64BE(id);
+        derived().writeUInt64BE(id);
     } else {
-        writeVariableLengthUIntBE(id);
+        derived().writeVariableLengthUIntBE(id);
     }
     if (!alreadyWritten) {
         alreadyWritten = true;
-        write(*pointer);
+        derived().write(*pointer);
     }
 }
 
-template <typename Type, Traits::EnableIf<IsIteratableExceptString<Type>, Traits::HasSize<Type>> *>
-void BinarySerializer::write(const Type &iteratable)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsIteratableExceptString<Type>, Traits::HasSize<Type>, Traits::Not<IsContiguousNumberRange<Type>>> *>
+void BasicBinarySerializer<Derived>::write(const Type &iteratable)
 {
-    writeVariableLengthUIntBE(iteratable.size());
+    derived().writeVariableLengthUIntBE(iteratable.size());
     for (const auto &element : iteratable) {
-        write(element);
+        derived().write(element);
     }
 }
 
-template <typename Type, Traits::EnableIf<std::is_enum<Type>> *> void BinarySerializer::write(const Type &enumValue)
+/*!
+ * \brief Writes a contiguous range of numbers at once or, if the byte order differs from the host's, in converted chunks.
+ * \remarks Produces the same result as writing element by element.
+ */
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsContiguousNumberRange<Type>> *>
+void BasicBinarySerializer<Derived>::write(const Type &iteratable)
 {
-    write(static_cast<typename std::underlying_type<Type>::type>(enumValue));
+    using Element = typename Type::value_type;
+    derived().writeVariableLengthUIntBE(iteratable.size());
+    if (sizeof(Element) == 1 || m_format == Detail::hostFormat) {
+        derived().write(reinterpret_cast<const char *>(iteratable.data()), static_cast<std::streamsize>(iteratable.size() * sizeof(Element)));
+    } else if constexpr (sizeof(Element) > 1) {
+        constexpr auto elementsPerChunk = std::size_t(4096) / sizeof(Element);
+        char chunk[elementsPerChunk * sizeof(Element)];
+        for (auto *i = iteratable.data(), *const end = i + iteratable.size(); i != end;) {
+            const auto count = std::min<std::size_t>(static_cast<std::size_t>(end - i), elementsPerChunk);
+            Detail::copyWithSwappedByteOrder(i, count, chunk);
+            derived().write(chunk, static_cast<std::streamsize>(count * sizeof(Element)));
+            i += count;
+        }
+    }
 }
 
-template <typename Type, Traits::EnableIf<IsVariant<Type>> *> void BinarySerializer::write(const Type &variant)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<std::is_enum<Type>> *>
+void BasicBinarySerializer<Derived>::write(const Type &enumValue)
+{
+    derived().write(static_cast<typename std::underlying_type<Type>::type>(enumValue));
+}
+
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsVariant<Type>> *>
+void BasicBinarySerializer<Derived>::write(const Type &variant)
 {
     static_assert(std::variant_size_v<Type> < std::numeric_limits<std::uint8_t>::max(), "index will not exceed limit");
-    writeByte(static_cast<std::uint8_t>(variant.index()));
+    derived().writeByte(static_cast<std::uint8_t>(variant.index()));
     std::visit(
         [this](const auto &valueOfActualType) {
             if constexpr (!std::is_same_v<std::decay_t<decltype(valueOfActualType)>, std::monostate>) {
-                write(valueOfActualType);
+                derived().write(valueOfActualType);
             } else {
                 CPP_UTILITIES_UNUSED(this)
             }
@@ -286,9 +790,588 @@ template <typename Type, Traits::EnableIf<IsVariant<Type>> *> void BinarySeriali
         variant);
 }
 
-template <typename Type, Traits::EnableIf<IsCustomType<Type>> *> void BinarySerializer::write(const Type &customType)
+template <typename Derived>
+template <typename Type, Traits::EnableIf<IsCustomType<Type>> *>
+void BasicBinarySerializer<Derived>::write(const Type &customType)
+{
+    writeCustomType(derived(), customType);
+}
+
+inline BinaryDeserializer::BinaryDeserializer(std::istream *stream, BinaryFormat format)
+    : CppUtilities::BinaryReader(stream)
+    , BasicBinaryDeserializer<BinaryDeserializer>(format)
+{
+}
+
+/*!
+ * \brief Throws a CppUtilities::ConversionException because there is no buffer an std::string_view could reference.
+ * \remarks This overload exists so code generated for types containing an std::string_view compiles. Use BufferDeserializer to
+ *          deserialize such types.
+ */
+inline void BinaryDeserializer::read(std::string_view &)
+{
+    throw CppUtilities::ConversionException("Deserializing an std::string_view requires a BufferDeserializer");
+}
+
+inline void BinaryDeserializer::read(std::int16_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readInt16LE() : readInt16BE();
+}
+
+inline void BinaryDeserializer::read(std::uint16_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readUInt16LE() : readUInt16BE();
+}
+
+inline void BinaryDeserializer::read(std::int32_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readInt32LE() : readInt32BE();
+}
+
+inline void BinaryDeserializer::read(std::uint32_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readUInt32LE() : readUInt32BE();
+}
+
+inline void BinaryDeserializer::read(std::int64_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readInt64LE() : readInt64BE();
+}
+
+inline void BinaryDeserializer::read(std::uint64_t &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readUInt64LE() : readUInt64BE();
+}
+
+inline void BinaryDeserializer::read(float &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readFloat32LE() : readFloat32BE();
+}
+
+inline void BinaryDeserializer::read(double &value)
+{
+    value = format() == BinaryFormat::LittleEndian ? readFloat64LE() : readFloat64BE();
+}
+
+inline BinarySerializer::BinarySerializer(std::ostream *stream, BinaryFormat format)
+    : CppUtilities::BinaryWriter(stream)
+    , BasicBinarySerializer<BinarySerializer>(format)
+{
+}
+
+inline void BinarySerializer::write(std::int16_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeInt16LE(value);
+    } else {
+        writeInt16BE(value);
+    }
+}
+
+inline void BinarySerializer::write(std::uint16_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeUInt16LE(value);
+    } else {
+        writeUInt16BE(value);
+    }
+}
+
+inline void BinarySerializer::write(std::int32_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeInt32LE(value);
+    } else {
+        writeInt32BE(value);
+    }
+}
+
+inline void BinarySerializer::write(std::uint32_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeUInt32LE(value);
+    } else {
+        writeUInt32BE(value);
+    }
+}
+
+inline void BinarySerializer::write(std::int64_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeInt64LE(value);
+    } else {
+        writeInt64BE(value);
+    }
+}
+
+inline void BinarySerializer::write(std::uint64_t value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeUInt64LE(value);
+    } else {
+        writeUInt64BE(value);
+    }
+}
+
+inline void BinarySerializer::write(float value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeFloat32LE(value);
+    } else {
+        writeFloat32BE(value);
+    }
+}
+
+inline void BinarySerializer::write(double value)
+{
+    if (format() == BinaryFormat::LittleEndian) {
+        writeFloat64LE(value);
+    } else {
+        writeFloat64BE(value);
+    }
+}
+
+inline BufferDeserializer::BufferDeserializer(const std::byte *data, std::size_t size, BinaryFormat format)
+    : BasicBinaryDeserializer<BufferDeserializer>(format)
+    , m_position(data)
+    , m_end(data + size)
+{
+}
+
+inline BufferDeserializer::BufferDeserializer(const std::vector<std::byte> &buffer, BinaryFormat format)
+    : BufferDeserializer(buffer.data(), buffer.size(), format)
+{
+}
+
+/*!
+ * \brief Returns the current position within the buffer.
+ */
+inline const std::byte *BufferDeserializer::position() const
+{
+    return m_position;
+}
+
+/*!
+ * \brief Returns the number of bytes which have not been read yet.
+ */
+inline std::size_t BufferDeserializer::bytesLeft() const
+{
+    return static_cast<std::size_t>(m_end - m_position);
+}
+
+/*!
+ * \brief Returns the next \a count bytes and advances the position accordingly.
+ * \throws Throws a CppUtilities::ConversionException if less than \a count bytes are left.
+ */
+inline const char *BufferDeserializer::consume(std::size_t count)
+{
+    if (count > bytesLeft()) {
+        throw CppUtilities::ConversionException("Unexpected end of buffer");
+    }
+    const auto *const data = reinterpret_cast<const char *>(m_position);
+    m_position += count;
+    return data;
+}
+
+template <typename Number> inline Number BufferDeserializer::readNumber()
+{
+    auto value = Number();
+    std::memcpy(&value, consume(sizeof(Number)), sizeof(Number));
+    return format() == Detail::hostFormat ? value : Detail::swapByteOrder(value);
+}
+
+inline void BufferDeserializer::read(char *buffer, std::streamsize length)
+{
+    const auto size = static_cast<std::size_t>(length);
+    std::memcpy(buffer, consume(size), size);
+}
+
+inline void BufferDeserializer::read(char &value)
+{
+    value = *consume(1);
+}
+
+inline void BufferDeserializer::read(std::uint8_t &value)
+{
+    value = readByte();
+}
+
+inline void BufferDeserializer::read(bool &value)
+{
+    value = readBool();
+}
+
+inline void BufferDeserializer::read(std::string &value)
+{
+    auto view = std::string_view();
+    read(view);
+    value.assign(view.data(), view.size());
+}
+
+/*!
+ * \brief Reads a length-prefixed string without copying it.
+ * \remarks The returned view references the buffer directly so it is only valid as long as the buffer is.
+ */
+inline void BufferDeserializer::read(std::string_view &value)
+{
+    const auto size = readVariableLengthUIntBE();
+    if (size > bytesLeft()) {
+        throw CppUtilities::ConversionException("Unexpected end of buffer");
+    }
+    const auto length = static_cast<std::size_t>(size);
+    value = std::string_view(consume(length), length);
+}
+
+inline void BufferDeserializer::read(std::int16_t &value)
+{
+    value = readNumber<std::int16_t>();
+}
+
+inline void BufferDeserializer::read(std::uint16_t &value)
+{
+    value = readNumber<std::uint16_t>();
+}
+
+inline void BufferDeserializer::read(std::int32_t &value)
+{
+    value = readNumber<std::int32_t>();
+}
+
+inline void BufferDeserializer::read(std::uint32_t &value)
+{
+    value = readNumber<std::uint32_t>();
+}
+
+inline void BufferDeserializer::read(std::int64_t &value)
+{
+    value = readNumber<std::int64_t>();
+}
+
+inline void BufferDeserializer::read(std::uint64_t &value)
+{
+    value = readNumber<std::uint64_t>();
+}
+
+inline void BufferDeserializer::read(float &value)
+{
+    value = readNumber<float>();
+}
+
+inline void BufferDeserializer::read(double &value)
+{
+    value = readNumber<double>();
+}
+
+inline std::uint8_t BufferDeserializer::readByte()
+{
+    return static_cast<std::uint8_t>(*consume(1));
+}
+
+inline bool BufferDeserializer::readBool()
+{
+    return readByte() != 0;
+}
+
+inline std::uint64_t BufferDeserializer::readUInt64BE()
+{
+    return CppUtilities::BE::toUInt64(consume(sizeof(std::uint64_t)));
+}
+
+/*!
+ * \brief Reads a variable-length integer as written by CppUtilities::BinaryWriter::writeVariableLengthUIntBE().
+ * \remarks The number of leading zero bits of the first byte denotes the number of additional bytes.
+ */
+inline std::uint64_t BufferDeserializer::readVariableLengthUIntBE()
+{
+    if (!bytesLeft()) {
+        throw CppUtilities::ConversionException("Unexpected end of buffer");
+    }
+    const auto firstByte = static_cast<std::uint8_t>(*m_position);
+    auto mask = std::uint8_t(0x80);
+    auto prefixLength = std::size_t(1);
+    while (prefixLength <= 8 && !(firstByte & mask)) {
+        ++prefixLength;
+        mask >>= 1;
+    }
+    if (prefixLength > 8) {
+        throw CppUtilities::ConversionException("Length denotation of variable length unsigned integer exceeds maximum.");
+    }
+    const auto *const bytes = consume(prefixLength);
+    auto value = static_cast<std::uint64_t>(firstByte ^ mask);
+    for (auto i = std::size_t(1); i != prefixLength; ++i) {
+        value = (value << 8) | static_cast<std::uint8_t>(bytes[i]);
+    }
+    return value;
+}
+
+inline std::string BufferDeserializer::readLengthPrefixedString()
+{
+    auto value = std::string();
+    read(value);
+    return value;
+}
+
+inline BufferSerializer::BufferSerializer(std::vector<std::byte> *buffer, BinaryFormat format)
+    : BasicBinarySerializer<BufferSerializer>(format)
+    , m_buffer(*buffer)
+{
+}
+
+/*!
+ * \brief Returns the buffer written to.
+ */
+inline std::vector<std::byte> &BufferSerializer::buffer()
+{
+    return m_buffer;
+}
+
+template <typename Number> inline void BufferSerializer::writeNumber(Number value)
+{
+    if (format() != Detail::hostFormat) {
+        value = Detail::swapByteOrder(value);
+    }
+    append(reinterpret_cast<const char *>(&value), sizeof(Number));
+}
+
+inline void BufferSerializer::append(const char *buffer, std::size_t length)
+{
+    const auto *const bytes = reinterpret_cast<const std::byte *>(buffer);
+    m_buffer.insert(m_buffer.end(), bytes, bytes + length);
+}
+
+inline void BufferSerializer::write(const char *buffer, std::streamsize length)
+{
+    append(buffer, static_cast<std::size_t>(length));
+}
+
+inline void BufferSerializer::write(char value)
+{
+    m_buffer.push_back(static_cast<std::byte>(value));
+}
+
+inline void BufferSerializer::write(std::uint8_t value)
+{
+    writeByte(value);
+}
+
+inline void BufferSerializer::write(bool value)
+{
+    writeBool(value);
+}
+
+inline void BufferSerializer::write(const std::string &value)
+{
+    writeLengthPrefixedString(value);
+}
+
+inline void BufferSerializer::write(std::string_view value)
+{
+    writeLengthPrefixedString(value);
+}
+
+inline void BufferSerializer::write(std::int16_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(std::uint16_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(std::int32_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(std::uint32_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(std::int64_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(std::uint64_t value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(float value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::write(double value)
+{
+    writeNumber(value);
+}
+
+inline void BufferSerializer::writeByte(std::uint8_t value)
+{
+    m_buffer.push_back(static_cast<std::byte>(value));
+}
+
+inline void BufferSerializer::writeBool(bool value)
+{
+    writeByte(value ? 1 : 0);
+}
+
+inline void BufferSerializer::writeUInt64BE(std::uint64_t value)
+{
+    char bytes[sizeof(std::uint64_t)];
+    CppUtilities::BE::getBytes(value, bytes);
+    append(bytes, sizeof(std::uint64_t));
+}
+
+/*!
+ * \brief Writes a variable-length integer like CppUtilities::BinaryWriter::writeVariableLengthUIntBE().
+ * \throws Throws a CppUtilities::ConversionException if \a value exceeds the maximum (2^56 - 1).
+ */
+inline void BufferSerializer::writeVariableLengthUIntBE(std::uint64_t value)
+{
+    const auto prefixLength = Detail::variableLengthUIntSize(value);
+    const auto lengthMarker = std::uint64_t(0x80) << (7 * (prefixLength - 1));
+    char bytes[sizeof(std::uint64_t)];
+    CppUtilities::BE::getBytes(value | lengthMarker, bytes);
+    append(bytes + sizeof(std::uint64_t) - prefixLength, prefixLength);
+}
+
+inline void BufferSerializer::writeLengthPrefixedString(std::string_view value)
+{
+    writeVariableLengthUIntBE(value.size());
+    append(value.data(), value.size());
+}
+
+/*!
+ * \brief Constructs a new CountingSerializer.
+ * \remarks The host's byte order is used because the format does not affect the size but would require converting contiguous number
+ *          ranges.
+ */
+inline CountingSerializer::CountingSerializer()
+    : BasicBinarySerializer<CountingSerializer>(Detail::hostFormat)
+    , m_size(0)
+{
+}
+
+/*!
+ * \brief Returns the number of bytes "written" so far.
+ */
+inline std::size_t CountingSerializer::size() const
+{
+    return m_size;
+}
+
+inline void CountingSerializer::write(const char *, std::streamsize length)
+{
+    m_size += static_cast<std::size_t>(length);
+}
+
+inline void CountingSerializer::write(char)
+{
+    m_size += 1;
+}
+
+inline void CountingSerializer::write(std::uint8_t)
+{
+    m_size += 1;
+}
+
+inline void CountingSerializer::write(bool)
+{
+    m_size += 1;
+}
+
+inline void CountingSerializer::write(const std::string &value)
+{
+    writeLengthPrefixedString(value);
+}
+
+inline void CountingSerializer::write(std::string_view value)
+{
+    writeLengthPrefixedString(value);
+}
+
+inline void CountingSerializer::write(std::int16_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(std::uint16_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(std::int32_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(std::uint32_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(std::int64_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(std::uint64_t value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(float value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::write(double value)
+{
+    m_size += sizeof(value);
+}
+
+inline void CountingSerializer::writeByte(std::uint8_t)
+{
+    m_size += 1;
+}
+
+inline void CountingSerializer::writeBool(bool)
+{
+    m_size += 1;
+}
+
+inline void CountingSerializer::writeUInt64BE(std::uint64_t)
+{
+    m_size += sizeof(std::uint64_t);
+}
+
+inline void CountingSerializer::writeVariableLengthUIntBE(std::uint64_t value)
+{
+    m_size += Detail::variableLengthUIntSize(value);
+}
+
+inline void CountingSerializer::writeLengthPrefixedString(std::string_view value)
+{
+    writeVariableLengthUIntBE(value.size());
+    m_size += value.size();
+}
+
+/*!
+ * \brief Returns the exact number of bytes the binary representation of the specified \a value takes.
+ * \remarks
+ * - This allows allocating the buffer to serialize to at once. It requires traversing \a value though.
+ * - The header written by BasicBinarySerializer::writeHeader() is not taken into account.
+ * - Custom types are covered as long as writeCustomType() is a template over the serializer (like the generated one is).
+ */
+template <typename Type> std::size_t binarySize(const Type &value)
 {
-    writeCustomType(*this, customType);
+    CountingSerializer serializer;
+    serializer.write(value);
+    return serializer.size();
 }
 
 } // namespace BinaryReflector
@@ -9,8 +9,10 @@
 
 #include "./reflector.h"
 
+#include <cstddef>
 #include <iosfwd>
 #include <string>
+#include <vector>
 
 namespace ReflectiveRapidJSON {
 
@@ -18,30 +20,91 @@ namespace ReflectiveRapidJSON {
  * \brief The BinarySerializable class provides the CRTP-base for (de)serializable objects.
  */
 template <typename Type> struct BinarySerializable {
-    void toBinary(std::ostream &outputStream) const;
-    void restoreFromBinary(std::istream &inputStream);
-    static Type fromBinary(std::istream &inputStream);
+    void toBinary(std::ostream &outputStream, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian) const;
+    void toBinary(std::vector<std::byte> &buffer, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian) const;
+    void restoreFromBinary(std::istream &inputStream, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian);
+    void restoreFromBinary(const std::byte *data, std::size_t size, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian);
+    static Type fromBinary(std::istream &inputStream, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian);
+    static Type fromBinary(const std::byte *data, std::size_t size, BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian);
+    std::size_t binarySize(BinaryReflector::BinaryFormat format = BinaryReflector::BinaryFormat::BigEndian) const;
 
     static constexpr const char *qualifiedName = "ReflectiveRapidJSON::BinarySerializable";
 };
 
-template <typename Type> inline void BinarySerializable<Type>::toBinary(std::ostream &outputStream) const
+/*!
+ * \brief Serializes the object to the specified \a outputStream using the specified \a format.
+ * \remarks The little-endian format is preceded by a header so deserializing it with a different format fails early.
+ */
+template <typename Type> inline void BinarySerializable<Type>::toBinary(std::ostream &outputStream, BinaryReflector::BinaryFormat format) const
+{
+    BinaryReflector::BinarySerializer serializer(&outputStream, format);
+    serializer.writeHeader();
+    serializer.write(static_cast<const Type &>(*this));
+}
+
+/*!
+ * \brief Serializes the object by appending it to the specified \a buffer.
+ * \remarks
+ * - This avoids the overhead of going through an std::ostream (see BinaryReflector::BufferSerializer).
+ * - The buffer grows as needed while serializing. To allocate it only once, reserve binarySize() bytes upfront. This is not
+ *   done automatically because determining the size traverses the whole object which is only worthwhile for big objects.
+ */
+template <typename Type> inline void BinarySerializable<Type>::toBinary(std::vector<std::byte> &buffer, BinaryReflector::BinaryFormat format) const
+{
+    BinaryReflector::BufferSerializer serializer(&buffer, format);
+    serializer.writeHeader();
+    serializer.write(static_cast<const Type &>(*this));
+}
+
+/*!
+ * \brief Restores the object from the specified \a inputStream which is expected to contain data in the specified \a format.
+ * \throws Throws a CppUtilities::ConversionException if the header required by the little-endian format is missing.
+ */
+template <typename Type> inline void BinarySerializable<Type>::restoreFromBinary(std::istream &inputStream, BinaryReflector::BinaryFormat format)
 {
-    BinaryReflector::BinarySerializer(&outputStream).write(static_cast<const Type &>(*this));
+    BinaryReflector::BinaryDeserializer deserializer(&inputStream, format);
+    deserializer.readHeader();
+    deserializer.read(static_cast<Type &>(*this));
 }
 
-template <typename Type> inline void BinarySerializable<Type>::restoreFromBinary(std::istream &inputStream)
+/*!
+ * \brief Restores the object from the specified buffer.
+ * \remarks
+ * - This avoids the overhead of going through an std::istream (see BinaryReflector::BufferDeserializer).
+ * - The buffer can be a memory-mapped file. It must outlive the object if the object contains std::string_view members
+ *   because those reference the buffer instead of being copied.
+ */
+template <typename Type>
+inline void BinarySerializable<Type>::restoreFromBinary(const std::byte *data, std::size_t size, BinaryReflector::BinaryFormat format)
+{
+    BinaryReflector::BufferDeserializer deserializer(data, size, format);
+    deserializer.readHeader();
+    deserializer.read(static_cast<Type &>(*this));
+}
+
+template <typename Type> Type BinarySerializable<Type>::fromBinary(std::istream &inputStream, BinaryReflector::BinaryFormat format)
 {
-    BinaryReflector::BinaryDeserializer(&inputStream).read(static_cast<Type &>(*this));
+    Type object;
+    static_cast<BinarySerializable<Type> &>(object).restoreFromBinary(inputStream, format);
+    return object;
 }
 
-template <typename Type> Type BinarySerializable<Type>::fromBinary(std::istream &inputStream)
+template <typename Type> Type BinarySerializable<Type>::fromBinary(const std::byte *data, std::size_t size, BinaryReflector::BinaryFormat format)
 {
     Type object;
-    static_cast<BinarySerializable<Type> &>(object).restoreFromBinary(inputStream);
+    static_cast<BinarySerializable<Type> &>(object).restoreFromBinary(data, size, format);
     return object;
 }
 
+/*!
+ * \brief Returns the exact number of bytes toBinary() would write using the specified \a format (including the header).
+ */
+template <typename Type> std::size_t BinarySerializable<Type>::binarySize(BinaryReflector::BinaryFormat format) const
+{
+    const auto headerSize = format == BinaryReflector::BinaryFormat::LittleEndian ? sizeof(BinaryReflector::Detail::littleEndianHeader) : 0;
+    return headerSize + BinaryReflector::binarySize(static_cast<const Type &>(*this));
+}
+
 /*!
  * \def The REFLECTIVE_RAPIDJSON_MAKE_BINARY_SERIALIZABLE macro allows to adapt (de)serialization for types defined in 3rd party header files.
  * \remarks The struct will not have the toBinary() and fromBinary() methods available. Use the corresponding functions in the namespace
@@ -158,6 +158,8 @@ struct JsonDeserializationErrors : public std::vector<JsonDeserializationError>
     void reportArraySizeMismatch();
     void reportConversionError(JsonType jsonType);
     void reportUnexpectedDuplicate(JsonType jsonType);
+    void reportInvalidVariantObject();
+    void reportInvalidVariantIndex(JsonType actualType);
 
     /// \brief The name of the class or struct which is currently being processed.
     const char *currentRecord;
@@ -172,6 +174,8 @@ struct JsonDeserializationErrors : public std::vector<JsonDeserializationError>
         ArraySizeMismatch = 0x2,
         ConversionError = 0x4,
         UnexpectedDuplicate = 0x8,
+        InvalidVariantObject = 0x10,
+        InvalidVariantIndex = 0x20,
         All = 0xFF,
     } throwOn;
 
@@ -253,6 +257,50 @@ inline void JsonDeserializationErrors::reportUnexpectedDuplicate(JsonType jsonTy
     throwMaybe(ThrowOn::UnexpectedDuplicate);
 }
 
+/*!
+ * \brief Reports an invalid variant object. An error of that kind occurs when the object supposed to represent an std::variant lacks the index or data member.
+ */
+inline void JsonDeserializationErrors::reportInvalidVariantObject()
+{
+    emplace_back(JsonDeserializationErrorKind::InvalidVariantObject, JsonType::Object, JsonType::Object, currentRecord, currentMember, currentIndex);
+    throwMaybe(ThrowOn::InvalidVariantObject);
+}
+
+/*!
+ * \brief Reports an invalid variant index. An error of that kind occurs when the index of a variant is not a number (\a actualType
+ *        is not JsonType::Number then) or outside of the expected range.
+ */
+inline void JsonDeserializationErrors::reportInvalidVariantIndex(JsonType actualType)
+{
+    emplace_back(JsonDeserializationErrorKind::InvalidVariantIndex, JsonType::Number, actualType, currentRecord, currentMember, currentIndex);
+    throwMaybe(ThrowOn::InvalidVariantIndex);
+}
+
+/*!
+ * \brief The JsonErrorMode enum specifies how fromJson() handles errors listed in JsonDeserializationErrorKind.
+ * \remarks It is specified via JsonReflector::JsonPolicy. The modes which do not maintain any context read the JSON via a
+ *          JsonReflector::BasicJsonReader instantiated for the mode so the bookkeeping is not compiled in at all.
+ */
+enum class JsonErrorMode : std::uint8_t {
+    Collect, /**< Errors are added to the JsonDeserializationErrors object passed to fromJson() (if any) along with their context. */
+    FailFast, /**< Deserialization stops at the first error throwing a JsonDeserializationFailure. No context is maintained while deserializing. */
+    Ignore, /**< Errors are ignored and no context is maintained while deserializing. */
+};
+
+/*!
+ * \brief The JsonDeserializationFailure struct describes the first error of fromJson() when using JsonErrorMode::FailFast.
+ */
+struct JsonDeserializationFailure {
+    /// \brief Which kind of error occured.
+    JsonDeserializationErrorKind kind;
+    /// \brief The expected type (might not be relevant for all error kinds).
+    JsonType expectedType;
+    /// \brief The actual type (might not be relevant for all error kinds).
+    JsonType actualType;
+    /// \brief The location of the value causing the error as JSON pointer (RFC 6901), e.g. "/testObjects/1/number".
+    std::string path;
+};
+
 } // namespace ReflectiveRapidJSON
 
 #endif // REFLECTIVE_RAPIDJSON_JSON_REFLECTOR_H
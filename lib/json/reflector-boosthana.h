@@ -16,21 +16,42 @@
 
 #include <boost/hana/adapt_struct.hpp>
 #include <boost/hana/at_key.hpp>
+#include <boost/hana/concept/struct.hpp>
 #include <boost/hana/define_struct.hpp>
 #include <boost/hana/for_each.hpp>
 #include <boost/hana/intersection.hpp>
 #include <boost/hana/keys.hpp>
+#include <boost/hana/length.hpp>
 
 namespace ReflectiveRapidJSON {
 namespace JsonReflector {
 
+/*!
+ * \brief Returns the JsonMemberName for the specified \a key using the length known at compile-time.
+ */
+template <typename Key> constexpr JsonMemberName memberName(Key key)
+{
+    return JsonMemberName{ std::string_view(boost::hana::to<char const *>(key), decltype(boost::hana::length(key))::value), std::string_view() };
+}
+
 // define function to "push" values to a RapidJSON array or object
 
 template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
 void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
 {
     boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &value, &allocator](auto key) {
-        push(boost::hana::at_key(reflectable, key), boost::hana::to<char const *>(key), value, allocator);
+        push(boost::hana::at_key(reflectable, key), memberName(key), value, allocator);
+    });
+}
+
+// define function to "push" only the differences between two values
+
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
+void pushDelta(const Type &reflectable, const Type &baseline, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &baseline, &value, &allocator](auto key) {
+        pushDelta(boost::hana::at_key(reflectable, key), boost::hana::at_key(baseline, key), memberName(key), value, allocator);
     });
 }
 
@@ -45,6 +66,52 @@ void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_N
     });
 }
 
+// define functions to "write", "read" and apply merge patches directly via a RapidJSON writer/JsonReader
+
+template <typename Type> struct HasJsonMembers<Type, std::enable_if_t<boost::hana::Struct<Type>::value>> : public Traits::Bool<true> {};
+
+template <typename Type> struct JsonMembers<Type, std::enable_if_t<boost::hana::Struct<Type>::value>> {
+    template <typename Writer> static void writeMembers(const Type &reflectable, Writer &writer)
+    {
+        boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &writer](auto key) {
+            write(boost::hana::at_key(reflectable, key), memberName(key), writer);
+        });
+    }
+
+    template <typename Writer> static void writeMembersWithoutDefaults(const Type &reflectable, const Type &defaults, Writer &writer)
+    {
+        boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &defaults, &writer](auto key) {
+            writeWithoutDefault(boost::hana::at_key(reflectable, key), boost::hana::at_key(defaults, key), memberName(key), writer);
+        });
+    }
+
+    template <typename Reader>
+    static bool readMember(Type &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        auto found = false;
+        boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &name, &reader, &errors, &found](auto key) {
+            if (!found && name == boost::hana::to<char const *>(key)) {
+                found = true;
+                read(boost::hana::at_key(reflectable, key), boost::hana::to<char const *>(key), reader, errors);
+            }
+        });
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(Type &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        auto found = false;
+        boost::hana::for_each(boost::hana::keys(reflectable), [&reflectable, &name, &reader, &errors, &found](auto key) {
+            if (!found && name == boost::hana::to<char const *>(key)) {
+                found = true;
+                mergePatch(boost::hana::at_key(reflectable, key), boost::hana::to<char const *>(key), reader, errors);
+            }
+        });
+        return found;
+    }
+};
+
 } // namespace JsonReflector
 } // namespace ReflectiveRapidJSON
 
@@ -35,6 +35,20 @@ inline void push<CppUtilities::TimeSpan>(
     value.SetString(str.data(), rapidJsonSize(str.size()), allocator);
 }
 
+// define functions to "write" values directly to a RapidJSON writer
+
+template <typename Writer> inline void write(const CppUtilities::DateTime &reflectable, Writer &writer)
+{
+    const std::string str(reflectable.toIsoString());
+    writer.String(str.data(), rapidJsonSize(str.size()), true);
+}
+
+template <typename Writer> inline void write(const CppUtilities::TimeSpan &reflectable, Writer &writer)
+{
+    const std::string str(reflectable.toString());
+    writer.String(str.data(), rapidJsonSize(str.size()), true);
+}
+
 // define functions to "pull" values from a RapidJSON array or object
 
 template <>
@@ -67,6 +81,34 @@ inline void pull<CppUtilities::TimeSpan>(CppUtilities::TimeSpan &reflectable,
     }
 }
 
+// define functions to "read" values directly from a JsonReader
+
+template <typename Reader> inline void read(CppUtilities::DateTime &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    std::string str;
+    read(str, reader, errors);
+    try {
+        reflectable = CppUtilities::DateTime::fromIsoStringGmt(str.data());
+    } catch (const CppUtilities::ConversionException &) {
+        if (errors) {
+            errors->reportConversionError(JsonType::String);
+        }
+    }
+}
+
+template <typename Reader> inline void read(CppUtilities::TimeSpan &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    std::string str;
+    read(str, reader, errors);
+    try {
+        reflectable = CppUtilities::TimeSpan::fromString(str.data());
+    } catch (const CppUtilities::ConversionException &) {
+        if (errors) {
+            errors->reportConversionError(JsonType::String);
+        }
+    }
+}
+
 } // namespace JsonReflector
 } // namespace ReflectiveRapidJSON
 
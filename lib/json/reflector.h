@@ -12,19 +12,33 @@
 #include <c++utilities/application/global.h>
 
 #include <rapidjson/document.h>
+#include <rapidjson/memorystream.h>
 #include <rapidjson/rapidjson.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/stringbuffer.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <charconv>
+#include <exception>
+#include <future>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
 #include <limits>
 #include <map>
 #include <memory>
+#include <optional>
+#include <ostream>
 #include <set>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <variant>
+#include <vector>
 
 #include "./errorhandling.h"
 
@@ -40,6 +54,16 @@ template <typename T> struct AdaptedJsonSerializable : public Traits::Bool<false
     static constexpr const char *qualifiedName = "ReflectiveRapidJSON::AdaptedJsonSerializable";
 };
 
+/*!
+ * \brief The JsonEnumByName class allows (de)serializing an enum via the names of its enumerators instead of their values.
+ * \remarks Specialize it via REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME so the code generator emits the name table
+ *          (JsonReflector::JsonEnumNames) for the enum.
+ */
+template <typename T> struct JsonEnumByName : public Traits::Bool<false> {
+    static constexpr const char *name = "JsonEnumByName";
+    static constexpr const char *qualifiedName = "ReflectiveRapidJSON::JsonEnumByName";
+};
+
 /*!
  * \brief The JsonReflector namespace contains helper functions to ease the use of RapidJSON for automatic (de)serialization.
  */
@@ -55,1089 +79,4435 @@ constexpr RAPIDJSON_NAMESPACE::SizeType rapidJsonSize(std::size_t size)
 }
 
 /*!
- * \brief Serializes the specified JSON \a document.
+ * \brief The JsonPolicy struct specifies the flags passed to RapidJSON when parsing and serializing JSON at compile-time.
+ * \tparam parseFlagsValue Specifies a combination of RAPIDJSON_NAMESPACE::ParseFlag (except kParseInsituFlag and
+ *         kParseNumbersAsStringsFlag), e.g. kParseFullPrecisionFlag or kParseNanAndInfFlag.
+ * \tparam writeFlagsValue Specifies a combination of RAPIDJSON_NAMESPACE::WriteFlag, e.g. kWriteNanAndInfFlag.
+ * \tparam maxDecimalPlacesValue Specifies the maximum number of decimal places written for floating-point numbers.
+ * \tparam errorModeValue Specifies how fromJson() handles errors (see JsonErrorMode).
+ * \remarks A policy can be passed as template argument to fromJson(), toJson() and the corresponding functions of JsonSerializable
+ *          to trade precision or validation for speed per call site, e.g. `fromJson<Type, JsonPolicy<kParseFullPrecisionFlag>>(json)`.
+ */
+template <unsigned parseFlagsValue = RAPIDJSON_NAMESPACE::kParseDefaultFlags, unsigned writeFlagsValue = RAPIDJSON_NAMESPACE::kWriteDefaultFlags,
+    int maxDecimalPlacesValue = RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces,
+    JsonErrorMode errorModeValue = JsonErrorMode::Collect>
+struct JsonPolicy {
+    static_assert(!(parseFlagsValue & RAPIDJSON_NAMESPACE::kParseNumbersAsStringsFlag),
+        "kParseNumbersAsStringsFlag is not supported because numbers are deserialized from number values only");
+    static constexpr unsigned parseFlags = parseFlagsValue;
+    static constexpr unsigned writeFlags = writeFlagsValue;
+    static constexpr int maxDecimalPlaces = maxDecimalPlacesValue;
+    static constexpr JsonErrorMode errorMode = errorModeValue;
+};
+
+/*!
+ * \brief The DefaultJsonPolicy uses RapidJSON's default flags.
+ */
+using DefaultJsonPolicy = JsonPolicy<>;
+
+/*!
+ * \brief The FailFastJsonPolicy uses RapidJSON's default flags and JsonErrorMode::FailFast.
+ */
+using FailFastJsonPolicy = JsonPolicy<RAPIDJSON_NAMESPACE::kParseDefaultFlags, RAPIDJSON_NAMESPACE::kWriteDefaultFlags,
+    RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces, JsonErrorMode::FailFast>;
+
+/*!
+ * \brief The IgnoreErrorsJsonPolicy uses RapidJSON's default flags and JsonErrorMode::Ignore.
+ */
+using IgnoreErrorsJsonPolicy = JsonPolicy<RAPIDJSON_NAMESPACE::kParseDefaultFlags, RAPIDJSON_NAMESPACE::kWriteDefaultFlags,
+    RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces, JsonErrorMode::Ignore>;
+
+/*!
+ * \brief Serializes the specified JSON \a document using the write flags of the specified \tparam Policy.
  */
-inline RAPIDJSON_NAMESPACE::StringBuffer serializeJsonDocToString(RAPIDJSON_NAMESPACE::Document &document)
+template <typename Policy = DefaultJsonPolicy> RAPIDJSON_NAMESPACE::StringBuffer serializeJsonDocToString(RAPIDJSON_NAMESPACE::Document &document)
 {
     RAPIDJSON_NAMESPACE::StringBuffer buffer;
-    RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer> writer(buffer);
+    RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer, RAPIDJSON_NAMESPACE::UTF8<>, RAPIDJSON_NAMESPACE::UTF8<>,
+        RAPIDJSON_NAMESPACE::CrtAllocator, Policy::writeFlags>
+        writer(buffer);
+    writer.SetMaxDecimalPlaces(Policy::maxDecimalPlaces);
     document.Accept(writer);
     return buffer;
 }
 
 /*!
- * \brief Parses the specified JSON string.
+ * \brief Parses the specified JSON string using the parse flags of the specified \tparam Policy.
  */
-inline RAPIDJSON_NAMESPACE::Document parseJsonDocFromString(const char *json, std::size_t jsonSize)
+template <typename Policy = DefaultJsonPolicy> RAPIDJSON_NAMESPACE::Document parseJsonDocFromString(const char *json, std::size_t jsonSize)
 {
     RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kObjectType);
-    const RAPIDJSON_NAMESPACE::ParseResult parseRes = document.Parse(json, jsonSize);
+    const RAPIDJSON_NAMESPACE::ParseResult parseRes = document.Parse<Policy::parseFlags>(json, jsonSize);
     if (parseRes.IsError()) {
         throw parseRes;
     }
     return document;
 }
 
-// define traits to distinguish between "built-in" types like int, std::string, std::vector, ... and custom structs/classes
-template <typename Type>
-using IsBuiltInType = Traits::Any<std::is_integral<Type>, std::is_floating_point<Type>, std::is_pointer<Type>, std::is_enum<Type>,
-    Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>, Traits::IsIteratable<Type>,
-    Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
-    Traits::IsSpecializationOf<Type, std::weak_ptr>, IsVariant<Type>>;
-template <typename Type> using IsCustomType = Traits::Not<IsBuiltInType<Type>>;
+/*!
+ * \brief The Context class keeps the memory used for parsing and building JSON documents to reuse it across calls.
+ * \remarks The memory pool of the document's values and the parse stack are backed by buffers owned by the context. When
+ *          parsing or building the next document these are reset via MemoryPoolAllocator::Clear() instead of being freed.
+ *          So as long as a document fits into the buffers no memory is allocated at all. Only the chunks allocated in addition
+ *          for bigger documents are freed when resetting.
+ * \remarks The document returned by parse() or toJsonDocument() is only valid until the context is used again.
+ */
+class Context {
+public:
+    using Allocator = RAPIDJSON_NAMESPACE::MemoryPoolAllocator<>;
+    using Document = RAPIDJSON_NAMESPACE::GenericDocument<RAPIDJSON_NAMESPACE::UTF8<char>, Allocator, Allocator>;
 
-// define trait to check for custom structs/classes which are JSON serializable
-// NOTE: the check for Traits::IsComplete is required because std::is_base_of fails for incomplete types when using GCC
-template <typename Type>
-using IsJsonSerializable
-    = Traits::Any<Traits::Not<Traits::IsComplete<Type>>, std::is_base_of<JsonSerializable<Type>, Type>, AdaptedJsonSerializable<Type>>;
+    explicit Context(std::size_t valueBufferSize = 64 * 1024, std::size_t stackBufferSize = 16 * 1024);
+    Context(const Context &) = delete;
+    Context &operator=(const Context &) = delete;
 
-// define functions to "push" values to a RapidJSON array or object
+    template <typename Policy = DefaultJsonPolicy> Document &parse(const char *json, std::size_t jsonSize);
+    Document &document();
+    void clear();
 
-/*!
- * \brief Pushes the specified \a reflectable to the specified value.
- */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+private:
+    std::unique_ptr<char[]> m_valueBuffer;
+    std::unique_ptr<char[]> m_stackBuffer;
+    Allocator m_valueAllocator;
+    Allocator m_stackAllocator;
+    Document m_document;
+};
 
 /*!
- * \brief Pushes the \a reflectable to the specified array.
+ * \brief Constructs a new context with buffers of the specified sizes.
  */
-template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+inline Context::Context(std::size_t valueBufferSize, std::size_t stackBufferSize)
+    : m_valueBuffer(std::make_unique<char[]>(valueBufferSize))
+    , m_stackBuffer(std::make_unique<char[]>(stackBufferSize))
+    , m_valueAllocator(m_valueBuffer.get(), valueBufferSize)
+    , m_stackAllocator(m_stackBuffer.get(), stackBufferSize)
+    , m_document(&m_valueAllocator, 1024, &m_stackAllocator)
+{
+}
 
 /*!
- * \brief Pushes the \a reflectable which has a custom type to the specified array.
+ * \brief Parses the specified JSON string like parseJsonDocFromString() but reusing the memory of the context.
+ * \remarks Invalidates the document returned by previous calls.
  */
-template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+template <typename Policy> inline Context::Document &Context::parse(const char *json, std::size_t jsonSize)
+{
+    clear();
+    const RAPIDJSON_NAMESPACE::ParseResult parseRes = m_document.template Parse<Policy::parseFlags>(json, jsonSize);
+    if (parseRes.IsError()) {
+        throw parseRes;
+    }
+    return m_document;
+}
 
 /*!
- * \brief Pushes the specified \a reflectable which has custom type as a member to the specified object.
+ * \brief Returns the document of the context.
+ * \remarks Call clear() before building a new document to reset the memory used by the previous one.
  */
-template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
-void push(
-    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+inline Context::Document &Context::document()
+{
+    return m_document;
+}
 
 /*!
- * \brief Pushes the specified \a reflectable as a member to the specified object.
+ * \brief Resets the document and the memory used by it for reuse.
+ * \remarks Invalidates the document returned by previous calls.
  */
-template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> * = nullptr>
-void push(
-    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+inline void Context::clear()
+{
+    m_document.SetNull();
+    m_valueAllocator.Clear();
+    m_stackAllocator.Clear();
+}
 
 /*!
- * \brief Pushes the \a reflectable which has a custom type to the specified object.
- * \remarks The definition of this function must be provided by the code generator or Boost.Hana.
+ * \brief The JsonOutputStream class is the RapidJSON output stream used by JsonWriter.
+ * \remarks Characters are put directly into a region of memory provided by the derived class which is only consulted
+ *          when that region is exhausted or the stream is flushed. This way the same write() functions can serialize
+ *          straight into different destinations (see the toJson() overloads) without copying the JSON afterwards.
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+class JsonOutputStream {
+public:
+    typedef char Ch;
+
+    void Put(Ch c);
+    void Flush();
+
+protected:
+    JsonOutputStream() = default;
+    ~JsonOutputStream() = default;
+
+    /// \brief Provides space for at least one further character by updating m_pos and m_end.
+    virtual void grow() = 0;
+    /// \brief Makes the characters put so far available at the destination.
+    virtual void commit() = 0;
+
+    Ch *m_pos = nullptr;
+    Ch *m_end = nullptr;
+};
 
 /*!
- * \brief Pushes the specified \a reflectable which has a custom type to the specified value.
+ * \brief Puts the specified character.
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
-inline void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline void JsonOutputStream::Put(Ch c)
 {
-    value.SetObject();
-    RAPIDJSON_NAMESPACE::Value::Object obj(value.GetObject());
-    push(reflectable, obj, allocator);
+    if (m_pos == m_end) {
+        grow();
+    }
+    *m_pos++ = c;
 }
 
 /*!
- * \brief Pushes the specified integer/float/boolean to the specified value.
+ * \brief Makes the characters put so far available at the destination.
+ * \remarks This is called by RapidJSON's Writer when the root value is complete.
  */
-template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
-inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline void JsonOutputStream::Flush()
 {
-    value.Set(reflectable, allocator);
+    commit();
 }
 
 /*!
- * \brief Pushes the specified enumeration item to the specified value.
+ * \brief The JsonStringOutputStream class appends to an std::string.
+ * \remarks The characters are put directly into the string's storage. Its existing capacity is used first so reusing the
+ *          same string for multiple calls avoids allocations.
+ * \remarks The string is resized to the characters actually put when the stream is destroyed (and not already when flushing).
  */
-template <typename Type, Traits::EnableIfAny<std::is_enum<Type>> * = nullptr>
-inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-{
-    value.Set(static_cast<Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>>(reflectable),
-        allocator);
-}
+class JsonStringOutputStream : public JsonOutputStream {
+public:
+    explicit JsonStringOutputStream(std::string &out);
+    ~JsonStringOutputStream();
+
+protected:
+    void grow() override;
+    void commit() override;
+
+private:
+    std::string &m_out;
+};
 
 /*!
- * \brief Pushes the specified C-string to the specified value.
+ * \brief Constructs a new stream appending to the specified \a out.
  */
-template <typename Type, Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>> * = nullptr>
-inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline JsonStringOutputStream::JsonStringOutputStream(std::string &out)
+    : m_out(out)
 {
-    if (reflectable) {
-        value.SetString(reflectable, allocator);
-    } else {
-        value.SetNull();
-    }
 }
 
 /*!
- * \brief Pushes the specified C-string to the specified value.
+ * \brief Shrinks the string to the characters actually put.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string_view>> * = nullptr>
-inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline JsonStringOutputStream::~JsonStringOutputStream()
 {
-    if (reflectable.data()) {
-        value.SetString(reflectable.data(), rapidJsonSize(reflectable.size()), allocator);
-    } else {
-        value.SetNull();
+    if (m_pos) {
+        m_out.resize(static_cast<std::size_t>(m_pos - m_out.data()));
     }
 }
 
-/*!
- * \brief Pushes the specified std::string to the specified value.
- */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
-inline void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline void JsonStringOutputStream::grow()
 {
-    value.SetString(reflectable.data(), rapidJsonSize(reflectable.size()), allocator);
+    const auto size = m_pos ? static_cast<std::size_t>(m_pos - m_out.data()) : m_out.size();
+    m_out.resize(std::max(m_out.capacity(), size + std::max<std::size_t>(size, 256)));
+    m_pos = m_out.data() + size;
+    m_end = m_out.data() + m_out.size();
 }
 
-/*!
- * \brief Pushes the specified iteratable (eg. std::vector, std::list) to the specified value.
- */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::HasSize<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline void JsonStringOutputStream::commit()
 {
-    value.SetArray();
-    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
-    array.Reserve(reflectable.size(), allocator);
-    for (const auto &item : reflectable) {
-        push(item, array, allocator);
-    }
+    // the string is only shrunk on destruction; otherwise it would be filled again when growing after each flush
 }
 
 /*!
- * \brief Pushes the specified iteratable list (eg. std::vector, std::list) to the specified value.
+ * \brief The JsonStringBufferOutputStream class appends to a RAPIDJSON_NAMESPACE::StringBuffer.
+ * \remarks The characters are put directly into the buffer's storage.
  */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::HasSize<Type>>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-{
-    value.SetArray();
-    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
-    for (const auto &item : reflectable) {
-        push(item, array, allocator);
-    }
-}
+class JsonStringBufferOutputStream : public JsonOutputStream {
+public:
+    explicit JsonStringBufferOutputStream(RAPIDJSON_NAMESPACE::StringBuffer &out);
+    ~JsonStringBufferOutputStream();
+
+protected:
+    void grow() override;
+    void commit() override;
+
+private:
+    RAPIDJSON_NAMESPACE::StringBuffer &m_out;
+};
 
 /*!
- * \brief Pushes the specified map (std::map, std::unordered_map) to the specified value.
+ * \brief Constructs a new stream appending to the specified \a out.
  */
-template <typename Type, Traits::EnableIfAny<IsMapOrHash<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline JsonStringBufferOutputStream::JsonStringBufferOutputStream(RAPIDJSON_NAMESPACE::StringBuffer &out)
+    : m_out(out)
 {
-    value.SetObject();
-    RAPIDJSON_NAMESPACE::Value::Object object(value.GetObject());
-    for (const auto &item : reflectable) {
-        push(item.second, item.first.data(), object, allocator);
-    }
 }
 
 /*!
- * \brief Pushes the specified multimap (std::multimap, std::unordered_multimap) to the specified value.
+ * \brief Gives back the space reserved but not used so far.
  */
-template <typename Type, Traits::EnableIfAny<IsMultiMapOrHash<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+inline JsonStringBufferOutputStream::~JsonStringBufferOutputStream()
 {
-    value.SetObject();
-    for (const auto &item : reflectable) {
-        const auto memberName = RAPIDJSON_NAMESPACE::Value::StringRefType(item.first.data(), rapidJsonSize(item.first.size()));
-        const auto existingMember = value.FindMember(memberName);
-        const auto arrayAlreadyExists
-            = existingMember != value.MemberEnd() && existingMember->value.GetType() == RAPIDJSON_NAMESPACE::Type::kArrayType;
-        auto newArrayValue = RAPIDJSON_NAMESPACE::Value{ RAPIDJSON_NAMESPACE::kArrayType };
-        RAPIDJSON_NAMESPACE::Value::Array array = arrayAlreadyExists ? existingMember->value.GetArray() : newArrayValue.GetArray();
-        push(item.second, array, allocator);
-        if (!arrayAlreadyExists) {
-            value.AddMember(memberName, newArrayValue, allocator);
-        }
-    }
+    commit();
 }
 
-namespace Detail {
+inline void JsonStringBufferOutputStream::grow()
+{
+    commit();
+    const auto size = std::max<std::size_t>(m_out.GetSize(), 256);
+    m_pos = m_out.Push(size);
+    m_end = m_pos + size;
+}
+
+inline void JsonStringBufferOutputStream::commit()
+{
+    if (m_pos != m_end) {
+        m_out.Pop(static_cast<std::size_t>(m_end - m_pos));
+        m_end = m_pos;
+    }
+}
 
 /*!
- * \brief The TuplePushHelper class helps serializing tuples to JSON arrays.
+ * \brief The JsonGenericOutputStream class forwards to another RapidJSON output stream or to an std::ostream.
+ * \remarks The characters are collected in a fixed-size buffer and forwarded in chunks. In case of an std::ostream
+ *          std::ostream::write() is used rather than putting characters one by one (like RAPIDJSON_NAMESPACE::OStreamWrapper does).
  */
-template <class Tuple, std::size_t N> struct TuplePushHelper {
-    static void push(const Tuple &tuple, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-    {
-        TuplePushHelper<Tuple, N - 1>::push(tuple, value, allocator);
-        JsonReflector::push(std::get<N - 1>(tuple), value, allocator);
-    }
-};
+template <typename OutputStream> class JsonGenericOutputStream : public JsonOutputStream {
+public:
+    explicit JsonGenericOutputStream(OutputStream &out);
+    ~JsonGenericOutputStream();
 
-template <class Tuple> struct TuplePushHelper<Tuple, 1> {
-    static void push(const Tuple &tuple, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-    {
-        JsonReflector::push(std::get<0>(tuple), value, allocator);
-    }
+protected:
+    void grow() override;
+    void commit() override;
+
+private:
+    OutputStream &m_out;
+    Ch m_buffer[4096];
 };
-} // namespace Detail
 
 /*!
- * \brief Pushes the specified tuple to the specified value.
+ * \brief Constructs a new stream forwarding to the specified \a out.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+template <typename OutputStream>
+inline JsonGenericOutputStream<OutputStream>::JsonGenericOutputStream(OutputStream &out)
+    : m_out(out)
 {
-    value.SetArray();
-    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
-    array.Reserve(std::tuple_size<Type>::value, allocator);
-    Detail::TuplePushHelper<Type, std::tuple_size<Type>::value>::push(reflectable, array, allocator);
+    m_pos = m_buffer;
+    m_end = m_buffer + sizeof(m_buffer);
 }
 
 /*!
- * \brief Pushes the specified pair to the specified value.
+ * \brief Forwards the characters which have not been forwarded so far.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+template <typename OutputStream> inline JsonGenericOutputStream<OutputStream>::~JsonGenericOutputStream()
 {
-    value.SetArray();
-    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
-    array.Reserve(2, allocator);
-    push(reflectable.first, array, allocator);
-    push(reflectable.second, array, allocator);
+    commit();
 }
 
-/*!
- * \brief Pushes the specified unique_ptr, shared_ptr or weak_ptr to the specified value.
- */
-template <typename Type,
-    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
-        Traits::IsSpecializationOf<Type, std::weak_ptr>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+template <typename OutputStream> inline void JsonGenericOutputStream<OutputStream>::grow()
 {
-    if (!reflectable) {
-        value.SetNull();
-        return;
+    commit();
+}
+
+template <typename OutputStream> inline void JsonGenericOutputStream<OutputStream>::commit()
+{
+    if constexpr (std::is_base_of_v<std::ostream, OutputStream>) {
+        m_out.write(m_buffer, m_pos - m_buffer);
+    } else {
+        for (const Ch *i = m_buffer; i != m_pos; ++i) {
+            m_out.Put(*i);
+        }
+        m_out.Flush();
     }
-    push(*reflectable, value, allocator);
+    m_pos = m_buffer;
 }
 
 /*!
- * \brief Pushes the specified variant to the specified value.
+ * \brief The BasicJsonWriter type is used by the write() functions to serialize directly into a JsonOutputStream without
+ *        building an intermediate JSON document.
+ * \tparam writeFlags Specifies a combination of RAPIDJSON_NAMESPACE::WriteFlag like JsonPolicy::writeFlags.
  */
-template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-{
-    if (reflectable.valueless_by_exception()) {
-        value.SetNull();
-        return;
-    }
+template <unsigned writeFlags = RAPIDJSON_NAMESPACE::kWriteDefaultFlags>
+using BasicJsonWriter = RAPIDJSON_NAMESPACE::Writer<JsonOutputStream, RAPIDJSON_NAMESPACE::UTF8<>, RAPIDJSON_NAMESPACE::UTF8<>,
+    RAPIDJSON_NAMESPACE::CrtAllocator, writeFlags>;
 
-    RAPIDJSON_NAMESPACE::Value index, data;
-    index.SetInt(reflectable.index());
-    std::visit(
-        [&data, &allocator](const auto &reflectableOfActualType) {
-            if constexpr (!std::is_same_v<std::decay_t<decltype(reflectableOfActualType)>, std::monostate>) {
-                push(reflectableOfActualType, data, allocator);
-            } else {
-                CPP_UTILITIES_UNUSED(data)
-                CPP_UTILITIES_UNUSED(allocator)
-            }
-        },
-        reflectable);
+/*!
+ * \brief The JsonWriter type is the BasicJsonWriter using RapidJSON's default write flags.
+ */
+using JsonWriter = BasicJsonWriter<>;
 
-    value.SetObject();
-    value.AddMember("index", index, allocator);
-    value.AddMember("data", data, allocator);
-}
+/*!
+ * \brief The JsonMemberName struct holds the name of a member along with its length and its quoted and JSON-escaped form.
+ * \remarks The code generator emits instances of this struct via makeJsonMemberName() so the length of the name is known at
+ *          compile-time and push() and write() do not need to determine it at runtime. If \a quotedName is present, write()
+ *          emits it as-is instead of escaping the name again.
+ */
+struct JsonMemberName {
+    std::string_view name; /**< The actual name (which is null-terminated). */
+    std::string_view quotedName; /**< The name put into quotes and JSON-escaped. Might be empty if not known. */
+};
 
 /*!
- * \brief Pushes the specified \a reflectable which has a custom type to the specified array.
+ * \brief Returns a JsonMemberName for the specified string literals determining their lengths at compile-time.
  */
-template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> *>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+template <std::size_t nameSize, std::size_t quotedNameSize>
+constexpr JsonMemberName makeJsonMemberName(const char (&name)[nameSize], const char (&quotedName)[quotedNameSize])
 {
-    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
-    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
-    push(reflectable, object, allocator);
-    value.PushBack(objectValue, allocator);
+    return JsonMemberName{ std::string_view(name, nameSize - 1), std::string_view(quotedName, quotedNameSize - 1) };
 }
 
 /*!
- * \brief Pushes the specified \a reflectable to the specified array.
+ * \brief Returns the hash of the specified enumerator \a name used to look up enumerators by name (see JsonEnumNames).
+ * \remarks This is FNV-1a starting from an offset basis mixed with \a seed. The code generator searches a seed for which
+ *          the hashes of all enumerators of an enum are distinct within the generated table. So looking up a name requires
+ *          only one string comparison.
  */
-template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> *>
-void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+constexpr std::uint32_t enumNameHash(std::string_view name, std::uint32_t seed)
 {
-    RAPIDJSON_NAMESPACE::Value genericValue;
-    push(reflectable, genericValue, allocator);
-    value.PushBack(genericValue, allocator);
+    auto hash = static_cast<std::uint32_t>(2166136261u ^ seed);
+    for (const auto c : name) {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 16777619u;
+    }
+    return hash ^ (hash >> 16);
 }
 
 /*!
- * \brief Pushes the specified \a reflectable which has custom type as a member to the specified object.
+ * \brief The JsonEnumSlot struct is an entry of the perfect hash table provided by JsonEnumNames.
+ * \remarks Unused slots have an empty name.
  */
-template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> *>
-void push(
-    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
-{
-    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
-    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
-    push(reflectable, object, allocator);
-    value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name), objectValue, allocator);
-}
+template <typename Type> struct JsonEnumSlot {
+    std::string_view name;
+    Type value;
+};
 
 /*!
- * \brief Pushes the specified \a reflectable as a member to the specified object.
+ * \brief The JsonEnumNames struct provides the names of the enumerators of \tparam Type which is an enum.
+ * \remarks The definition of this struct must be provided by the code generator for enums which are marked via
+ *          REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME. It contains:
+ *          - `static constexpr JsonMemberName name(Type value)` returning the name of \a value (empty for unknown values)
+ *          - `static constexpr std::uint32_t hashSeed` and `hashMask` as well as `static constexpr JsonEnumSlot<Type> slots[]`
+ *            forming a perfect hash table from the names to the values (see enumNameHash() and enumValueByName())
  */
-template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> *>
-void push(
-    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+template <typename Type> struct JsonEnumNames;
+
+/*!
+ * \brief Returns the enumerator of \tparam Type with the specified \a name or nullptr if there is no such enumerator.
+ */
+template <typename Type> constexpr const Type *enumValueByName(std::string_view name)
 {
-    RAPIDJSON_NAMESPACE::Value genericValue;
-    push(reflectable, genericValue, allocator);
-    value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name), genericValue, allocator);
+    using Names = JsonEnumNames<Type>;
+    const auto &slot = Names::slots[enumNameHash(name, Names::hashSeed) & Names::hashMask];
+    return !slot.name.empty() && slot.name == name ? &slot.value : nullptr;
 }
 
-// define functions to "pull" values from a RapidJSON array or object
+/*!
+ * \brief The JsonToken enum specifies the token the JsonReader is currently positioned at.
+ */
+enum class JsonToken : std::uint8_t {
+    None, /**< No token has been read so far. */
+    Null, /**< A null value. */
+    Bool, /**< A boolean value. */
+    Number, /**< An integer or floating point number. */
+    String, /**< A string value. */
+    Key, /**< The name of an object member; the member's value follows. */
+    StartObject, /**< The beginning of an object. */
+    EndObject, /**< The end of an object. */
+    StartArray, /**< The beginning of an array. */
+    EndArray, /**< The end of an array. */
+};
+
+/// \cond
+namespace Detail {
+
+/// \brief The JsonInsituStream struct is the RapidJSON input stream used by BasicJsonReader when parsing in-situ.
+struct JsonInsituStream {
+    typedef char Ch;
+    Ch Peek() const;
+    Ch Take();
+    std::size_t Tell() const;
+    Ch *PutBegin();
+    void Put(Ch c);
+    std::size_t PutEnd(Ch *begin);
+    void Flush();
+
+    Ch *head;
+    Ch *src;
+    Ch *dst;
+    Ch *end;
+};
+
+/// \brief The JsonReaderHandler struct receives the tokens from RAPIDJSON_NAMESPACE::Reader on behalf of BasicJsonReader.
+struct JsonReaderHandler : public RAPIDJSON_NAMESPACE::BaseReaderHandler<RAPIDJSON_NAMESPACE::UTF8<char>, JsonReaderHandler> {
+    bool Null();
+    bool Bool(bool value);
+    bool Int(int value);
+    bool Uint(unsigned value);
+    bool Int64(std::int64_t value);
+    bool Uint64(std::uint64_t value);
+    bool Double(double value);
+    bool String(const char *str, RAPIDJSON_NAMESPACE::SizeType length, bool copy);
+    bool StartObject();
+    bool Key(const char *str, RAPIDJSON_NAMESPACE::SizeType length, bool copy);
+    bool EndObject(RAPIDJSON_NAMESPACE::SizeType memberCount);
+    bool StartArray();
+    bool EndArray(RAPIDJSON_NAMESPACE::SizeType elementCount);
+
+    std::string string;
+    std::string key;
+    std::string_view stringView;
+    std::string_view keyView;
+    std::int64_t int64Value = 0;
+    std::uint64_t uint64Value = 0;
+    double doubleValue = 0.0;
+    JsonToken token = JsonToken::None;
+    bool boolValue = false;
+    bool isInt64 = false;
+    bool isUint64 = false;
+};
+
+inline bool JsonReaderHandler::Null()
+{
+    token = JsonToken::Null;
+    return true;
+}
+
+inline bool JsonReaderHandler::Bool(bool value)
+{
+    token = JsonToken::Bool;
+    boolValue = value;
+    return true;
+}
+
+inline bool JsonReaderHandler::Int(int value)
+{
+    return Int64(value);
+}
+
+inline bool JsonReaderHandler::Uint(unsigned value)
+{
+    return Uint64(value);
+}
+
+inline bool JsonReaderHandler::Int64(std::int64_t value)
+{
+    token = JsonToken::Number;
+    int64Value = value;
+    uint64Value = static_cast<std::uint64_t>(value);
+    doubleValue = static_cast<double>(value);
+    isInt64 = true;
+    isUint64 = value >= 0;
+    return true;
+}
+
+inline bool JsonReaderHandler::Uint64(std::uint64_t value)
+{
+    token = JsonToken::Number;
+    int64Value = static_cast<std::int64_t>(value);
+    uint64Value = value;
+    doubleValue = static_cast<double>(value);
+    isInt64 = value <= static_cast<std::uint64_t>(std::numeric_limits<std::int64_t>::max());
+    isUint64 = true;
+    return true;
+}
+
+inline bool JsonReaderHandler::Double(double value)
+{
+    token = JsonToken::Number;
+    doubleValue = value;
+    isInt64 = isUint64 = false;
+    return true;
+}
+
+inline bool JsonReaderHandler::String(const char *str, RAPIDJSON_NAMESPACE::SizeType length, bool copy)
+{
+    token = JsonToken::String;
+    if (copy) {
+        string.assign(str, length);
+        stringView = string;
+    } else {
+        stringView = std::string_view(str, length);
+    }
+    return true;
+}
+
+inline bool JsonReaderHandler::StartObject()
+{
+    token = JsonToken::StartObject;
+    return true;
+}
+
+inline bool JsonReaderHandler::Key(const char *str, RAPIDJSON_NAMESPACE::SizeType length, bool copy)
+{
+    token = JsonToken::Key;
+    if (copy) {
+        key.assign(str, length);
+        keyView = key;
+    } else {
+        keyView = std::string_view(str, length);
+    }
+    return true;
+}
+
+inline bool JsonReaderHandler::EndObject(RAPIDJSON_NAMESPACE::SizeType)
+{
+    token = JsonToken::EndObject;
+    return true;
+}
+
+inline bool JsonReaderHandler::StartArray()
+{
+    token = JsonToken::StartArray;
+    return true;
+}
+
+inline bool JsonReaderHandler::EndArray(RAPIDJSON_NAMESPACE::SizeType)
+{
+    token = JsonToken::EndArray;
+    return true;
+}
+
+inline JsonInsituStream::Ch JsonInsituStream::Peek() const
+{
+    return src != end ? *src : '\0';
+}
+
+inline JsonInsituStream::Ch JsonInsituStream::Take()
+{
+    return src != end ? *src++ : '\0';
+}
+
+inline std::size_t JsonInsituStream::Tell() const
+{
+    return static_cast<std::size_t>(src - head);
+}
+
+inline JsonInsituStream::Ch *JsonInsituStream::PutBegin()
+{
+    return dst = src;
+}
+
+inline void JsonInsituStream::Put(Ch c)
+{
+    *dst++ = c;
+}
+
+inline std::size_t JsonInsituStream::PutEnd(Ch *begin)
+{
+    return static_cast<std::size_t>(dst - begin);
+}
+
+inline void JsonInsituStream::Flush()
+{
+}
+
+} // namespace Detail
+/// \endcond
 
 /*!
- * \brief Pulls the \a reflectable which has a custom type from the specified object.
- * \remarks The definition of this function must be provided by the code generator or Boost.Hana.
+ * \brief The BasicJsonReader class reads JSON token by token using the iterative parsing of RAPIDJSON_NAMESPACE::Reader.
+ * \remarks It is used by the read() functions to deserialize directly into the target object without building an
+ *          intermediate JSON document. So the peak memory usage is bounded by the target object.
+ * \remarks When constructed with BasicJsonReader::Insitu the JSON is parsed in-situ (RAPIDJSON_NAMESPACE::kParseInsituFlag). Then
+ *          strings are decoded within the specified buffer and stringValue() points into it rather than into an internal copy.
+ * \tparam parseFlags Specifies a combination of RAPIDJSON_NAMESPACE::ParseFlag (except kParseInsituFlag) like
+ *         JsonPolicy::parseFlags.
+ * \tparam errorMode Specifies the JsonErrorMode like JsonPolicy::errorMode. The read() functions only maintain the context of
+ *         errors (JsonDeserializationErrors::currentRecord, currentMember and currentIndex) for JsonErrorMode::Collect; for the
+ *         other modes the bookkeeping is not compiled in at all (see tracksErrorContext).
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
-void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
-    JsonDeserializationErrors *errors);
+template <unsigned parseFlags = RAPIDJSON_NAMESPACE::kParseDefaultFlags, JsonErrorMode errorMode = JsonErrorMode::Collect> class BasicJsonReader {
+    static_assert(!(parseFlags & RAPIDJSON_NAMESPACE::kParseInsituFlag), "in-situ parsing is selected via BasicJsonReader::Insitu");
+
+public:
+    /// \brief Tag to select in-situ parsing.
+    struct Insitu {
+    };
+
+    /// \brief Whether the read() functions maintain the context of errors when reading via this reader.
+    static constexpr bool tracksErrorContext = errorMode == JsonErrorMode::Collect;
+
+    explicit BasicJsonReader(const char *json, std::size_t jsonSize);
+    explicit BasicJsonReader(Insitu, char *json, std::size_t jsonSize);
+
+    JsonToken next();
+    void skip();
+    void finish();
+    JsonToken token() const;
+    RAPIDJSON_NAMESPACE::Type type() const;
+    bool boolValue() const;
+    bool isInt64() const;
+    bool isUint64() const;
+    template <typename Type> Type numberValue() const;
+    std::string_view stringValue() const;
+    void takeStringValue(std::string &target);
+    std::string_view key() const;
+    bool isInsitu() const;
+    std::size_t offset() const;
+
+private:
+    RAPIDJSON_NAMESPACE::MemoryStream m_stream;
+    Detail::JsonInsituStream m_insituStream;
+    RAPIDJSON_NAMESPACE::Reader m_reader;
+    Detail::JsonReaderHandler m_handler;
+    bool m_insitu;
+};
 
 /*!
- * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ * \brief The JsonReader type is the BasicJsonReader using RapidJSON's default parse flags.
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
-void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+using JsonReader = BasicJsonReader<>;
 
 /*!
- * \brief Pulls the specified \a reflectable which is an iteratable without reserve() method from the specified value which is checked to contain an array.
+ * \brief Constructs a new reader for the specified \a json. No tokens are read so far.
+ * \remarks The \a json must stay valid as long as the reader is used.
  */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::IsReservable<Type>>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode>
+inline BasicJsonReader<parseFlags, errorMode>::BasicJsonReader(const char *json, std::size_t jsonSize)
+    : m_stream(json, jsonSize)
+    , m_insituStream{ nullptr, nullptr, nullptr, nullptr }
+    , m_insitu(false)
+{
+    m_reader.IterativeParseInit();
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is an iteratable with reserve() method from the specified value which is checked to contain an array.
+ * \brief Constructs a new reader for parsing the specified \a json in-situ. No tokens are read so far.
+ * \remarks The \a json does not need to be null-terminated. It is modified while being parsed and must stay valid as long as
+ *          the reader or any string obtained via stringValue() is used.
  */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::IsReservable<Type>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode>
+inline BasicJsonReader<parseFlags, errorMode>::BasicJsonReader(Insitu, char *json, std::size_t jsonSize)
+    : m_stream(json, 0)
+    , m_insituStream{ json, json, json, json + jsonSize }
+    , m_insitu(true)
+{
+    m_reader.IterativeParseInit();
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is an array/vector/list from the specified array. The \a reflectable is cleared before.
+ * \brief Reads the next token and returns it.
+ * \throws Throws RAPIDJSON_NAMESPACE::ParseResult if the JSON is invalid (like parseJsonDocFromString()).
  */
-template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline JsonToken BasicJsonReader<parseFlags, errorMode>::next()
+{
+    if (m_insitu ? !m_reader.IterativeParseNext<parseFlags | RAPIDJSON_NAMESPACE::kParseInsituFlag>(m_insituStream, m_handler)
+                 : !m_reader.IterativeParseNext<parseFlags>(m_stream, m_handler)) {
+        throw RAPIDJSON_NAMESPACE::ParseResult(m_reader.GetParseErrorCode(), m_reader.GetErrorOffset());
+    }
+    return m_handler.token;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a set from the specified array. The \a reflectable is cleared before.
+ * \brief Skips the value which starts at the current token.
+ * \remarks Does nothing if the current token is already the whole value (eg. a number).
  */
-template <typename Type, Traits::EnableIf<IsSet<Type>> * = nullptr>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline void BasicJsonReader<parseFlags, errorMode>::skip()
+{
+    if (m_handler.token != JsonToken::StartObject && m_handler.token != JsonToken::StartArray) {
+        return;
+    }
+    for (std::size_t depth = 1; depth;) {
+        switch (next()) {
+        case JsonToken::StartObject:
+        case JsonToken::StartArray:
+            ++depth;
+            break;
+        case JsonToken::EndObject:
+        case JsonToken::EndArray:
+            --depth;
+            break;
+        default:;
+        }
+    }
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a multiset from the specified array. The \a reflectable is cleared before.
+ * \brief Returns the current token.
  */
-template <typename Type, Traits::EnableIf<IsMultiSet<Type>> * = nullptr>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline JsonToken BasicJsonReader<parseFlags, errorMode>::token() const
+{
+    return m_handler.token;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a map from the specified value which is checked to contain an object.
+ * \brief Returns the type of the value which starts at the current token.
+ * \remarks This is used for reporting type mismatches via JsonDeserializationErrors.
  */
-template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline RAPIDJSON_NAMESPACE::Type BasicJsonReader<parseFlags, errorMode>::type() const
+{
+    switch (m_handler.token) {
+    case JsonToken::Bool:
+        return m_handler.boolValue ? RAPIDJSON_NAMESPACE::kTrueType : RAPIDJSON_NAMESPACE::kFalseType;
+    case JsonToken::Number:
+        return RAPIDJSON_NAMESPACE::kNumberType;
+    case JsonToken::String:
+    case JsonToken::Key:
+        return RAPIDJSON_NAMESPACE::kStringType;
+    case JsonToken::StartObject:
+        return RAPIDJSON_NAMESPACE::kObjectType;
+    case JsonToken::StartArray:
+        return RAPIDJSON_NAMESPACE::kArrayType;
+    default:
+        return RAPIDJSON_NAMESPACE::kNullType;
+    }
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a multimap from the specified value which is checked to contain an object.
+ * \brief Returns the value of the current JsonToken::Bool token.
  */
-template <typename Type, Traits::EnableIf<IsMultiMapOrHash<Type>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline bool BasicJsonReader<parseFlags, errorMode>::boolValue() const
+{
+    return m_handler.boolValue;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a tuple from the specified value which is checked to contain an array.
+ * \brief Returns whether the current JsonToken::Number token is an integer which can be represented as std::int64_t.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline bool BasicJsonReader<parseFlags, errorMode>::isInt64() const
+{
+    return m_handler.token == JsonToken::Number && m_handler.isInt64;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a pair from the specified value which is checked to contain an array.
+ * \brief Returns whether the current JsonToken::Number token is an integer which can be represented as std::uint64_t.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline bool BasicJsonReader<parseFlags, errorMode>::isUint64() const
+{
+    return m_handler.token == JsonToken::Number && m_handler.isUint64;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a unique_ptr from the specified value which might be null.
+ * \brief Returns the value of the current JsonToken::Number token as \tparam Type.
+ * \remarks Integers which can not be represented as \tparam Type are converted from the floating point value like
+ *          pull() does.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode>
+template <typename Type>
+inline Type BasicJsonReader<parseFlags, errorMode>::numberValue() const
+{
+    if constexpr (std::is_integral_v<Type>) {
+        if (m_handler.isInt64 && m_handler.int64Value >= static_cast<std::int64_t>(std::numeric_limits<Type>::min())
+            && (!m_handler.isUint64 || m_handler.uint64Value <= static_cast<std::uint64_t>(std::numeric_limits<Type>::max()))) {
+            return static_cast<Type>(m_handler.int64Value);
+        }
+        if (m_handler.isUint64 && m_handler.uint64Value <= static_cast<std::uint64_t>(std::numeric_limits<Type>::max())) {
+            return static_cast<Type>(m_handler.uint64Value);
+        }
+    }
+    return static_cast<Type>(m_handler.doubleValue);
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a shared_ptr from the specified value which might be null.
+ * \brief Returns the value of the current JsonToken::String token.
+ * \remarks The returned view is valid until the next string is read unless parsing in-situ. In the in-situ case it points
+ *          into the buffer passed to the constructor and is null-terminated.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline std::string_view BasicJsonReader<parseFlags, errorMode>::stringValue() const
+{
+    return m_handler.stringView;
+}
 
 /*!
- * \brief Pulls the specified \a reflectable which is a variant from the specified value which might be null.
+ * \brief Assigns the value of the current JsonToken::String token to \a target.
+ * \remarks Moves the internal copy unless parsing in-situ; so stringValue() must not be used afterwards.
  */
-template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline void BasicJsonReader<parseFlags, errorMode>::takeStringValue(std::string &target)
+{
+    if (m_insitu) {
+        target.assign(m_handler.stringView);
+    } else {
+        target = std::move(m_handler.string);
+    }
+}
 
 /*!
- * \brief Pulls the specified \a reflectable from the specified value iterator which is checked to contain the right type.
+ * \brief Returns the member name of the current JsonToken::Key token.
+ * \remarks The returned view is valid until the next key is read.
  */
-template <typename Type>
-inline void pull(
-    Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ValueIterator &value, JsonDeserializationErrors *errors);
+template <unsigned parseFlags, JsonErrorMode errorMode> inline std::string_view BasicJsonReader<parseFlags, errorMode>::key() const
+{
+    return m_handler.keyView;
+}
 
 /*!
- * \brief Pulls the specified member of \a reflectable which has a custom type from the specified object.
- * \remarks It is checked whether the object actually contains the member. If not, the missing member is ignored. So currently all members
- *          are optional.
+ * \brief Returns whether the JSON is parsed in-situ.
+ */
+template <unsigned parseFlags, JsonErrorMode errorMode> inline bool BasicJsonReader<parseFlags, errorMode>::isInsitu() const
+{
+    return m_insitu;
+}
+
+/*!
+ * \brief Reads the remaining tokens of the root value and ensures that only whitespace follows it.
+ * \remarks This is supposed to be called after deserializing the root value so trailing content is not silently ignored (like
+ *          parseJsonDocFromString() does not ignore it either).
+ * \throws Throws RAPIDJSON_NAMESPACE::ParseResult with the code kParseErrorDocumentRootNotSingular if anything but whitespace
+ *         follows the root value or another code if the JSON is invalid.
+ */
+template <unsigned parseFlags, JsonErrorMode errorMode> inline void BasicJsonReader<parseFlags, errorMode>::finish()
+{
+    while (!m_reader.IterativeParseComplete()) {
+        next();
+    }
+    const auto atEnd = [](auto &stream) {
+        RAPIDJSON_NAMESPACE::SkipWhitespace(stream);
+        return stream.Peek() == '\0';
+    };
+    if (m_insitu ? !atEnd(m_insituStream) : !atEnd(m_stream)) {
+        throw RAPIDJSON_NAMESPACE::ParseResult(RAPIDJSON_NAMESPACE::kParseErrorDocumentRootNotSingular, offset());
+    }
+}
+
+/*!
+ * \brief Returns the number of characters which have been read so far.
+ * \remarks This is the offset right after the current token.
  */
+template <unsigned parseFlags, JsonErrorMode errorMode> inline std::size_t BasicJsonReader<parseFlags, errorMode>::offset() const
+{
+    return m_insitu ? m_insituStream.Tell() : m_stream.Tell();
+}
+
+// define traits to distinguish between "built-in" types like int, std::string, std::vector, ... and custom structs/classes
 template <typename Type>
-inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
-    JsonDeserializationErrors *errors);
+using IsBuiltInType = Traits::Any<std::is_integral<Type>, std::is_floating_point<Type>, std::is_pointer<Type>, std::is_enum<Type>,
+    Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>, Traits::IsIteratable<Type>,
+    Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+    Traits::IsSpecializationOf<Type, std::weak_ptr>, Traits::IsSpecializationOf<Type, std::optional>, IsVariant<Type>>;
+template <typename Type> using IsCustomType = Traits::Not<IsBuiltInType<Type>>;
+
+// define trait to check for custom structs/classes which are JSON serializable
+// NOTE: the check for Traits::IsComplete is required because std::is_base_of fails for incomplete types when using GCC
+template <typename Type>
+using IsJsonSerializable
+    = Traits::Any<Traits::Not<Traits::IsComplete<Type>>, std::is_base_of<JsonSerializable<Type>, Type>, AdaptedJsonSerializable<Type>>;
+
+namespace Detail {
 
 /*!
- * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ * \brief The JsonMapKey class converts keys of maps (std::map, std::unordered_map, ...) to JSON member names and back.
+ * \remarks This generic version handles string keys which are referenced as-is.
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
-void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+template <typename Key, typename = void> class JsonMapKey {
+public:
+    explicit JsonMapKey(const Key &key)
+        : m_name(key.data(), key.size())
+    {
+    }
+
+    std::string_view name() const
+    {
+        return m_name;
+    }
+
+    RAPIDJSON_NAMESPACE::Value value(RAPIDJSON_NAMESPACE::Document::AllocatorType &) const
+    {
+        return RAPIDJSON_NAMESPACE::Value(RAPIDJSON_NAMESPACE::StringRef(m_name.data(), rapidJsonSize(m_name.size())));
+    }
+
+    static bool parse(std::string_view name, Key &key)
+    {
+        key = Key(name.data(), name.size());
+        return true;
+    }
+
+private:
+    std::string_view m_name;
+};
+
+/*!
+ * \brief The JsonMapKey class converts integral and enum keys of maps to JSON member names and back.
+ * \remarks The number is converted into a buffer on the stack via std::to_chars() so no allocation is required. Enums marked
+ *          via REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME use the names of their enumerators (falling back to the number).
+ */
+template <typename Key>
+class JsonMapKey<Key, std::enable_if_t<(std::is_integral_v<Key> && !std::is_same_v<Key, bool>) || std::is_enum_v<Key>>> {
+    using Integer = typename std::conditional_t<std::is_enum_v<Key>, std::underlying_type<Key>, std::common_type<Key>>::type;
+
+public:
+    explicit JsonMapKey(Key key)
+    {
+        if constexpr (JsonEnumByName<Key>::value) {
+            if (const auto name = JsonEnumNames<Key>::name(key).name; !name.empty()) {
+                m_name = name;
+                m_isStatic = true;
+                return;
+            }
+        }
+        const auto res = std::to_chars(m_buffer, m_buffer + sizeof(m_buffer), static_cast<Integer>(key));
+        m_name = std::string_view(m_buffer, static_cast<std::size_t>(res.ptr - m_buffer));
+    }
+    JsonMapKey(const JsonMapKey &) = delete;
+    JsonMapKey &operator=(const JsonMapKey &) = delete;
+
+    std::string_view name() const
+    {
+        return m_name;
+    }
+
+    RAPIDJSON_NAMESPACE::Value value(RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator) const
+    {
+        return m_isStatic ? RAPIDJSON_NAMESPACE::Value(RAPIDJSON_NAMESPACE::StringRef(m_name.data(), rapidJsonSize(m_name.size())))
+                          : RAPIDJSON_NAMESPACE::Value(m_name.data(), rapidJsonSize(m_name.size()), allocator);
+    }
+
+    static bool parse(std::string_view name, Key &key)
+    {
+        if constexpr (JsonEnumByName<Key>::value) {
+            if (const auto *const enumValue = enumValueByName<Key>(name)) {
+                key = *enumValue;
+                return true;
+            }
+        }
+        auto integer = Integer();
+        const auto *const end = name.data() + name.size();
+        const auto res = std::from_chars(name.data(), end, integer);
+        if (res.ec != std::errc() || res.ptr != end) {
+            return false;
+        }
+        key = static_cast<Key>(integer);
+        return true;
+    }
+
+private:
+    char m_buffer[std::numeric_limits<Integer>::digits10 + 3];
+    std::string_view m_name;
+    bool m_isStatic = false;
+};
+
+} // namespace Detail
+
+// define functions to "push" values to a RapidJSON array or object
+
+/*!
+ * \brief Pushes the specified \a reflectable to the specified value.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the \a reflectable to the specified array.
+ */
+template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the \a reflectable which has a custom type to the specified array.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the specified \a reflectable which has custom type as a member to the specified object.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+void push(const Type &reflectable, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the specified \a reflectable as a member to the specified object.
+ */
+template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> * = nullptr>
+void push(const Type &reflectable, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the specified \a reflectable as a member with the specified null-terminated \a name to the specified object.
+ */
+template <typename Type>
+void push(
+    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the \a reflectable which has a custom type to the specified object.
+ * \remarks The definition of this function must be provided by the code generator or Boost.Hana.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the specified \a reflectable which has a custom type to the specified value.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
+inline void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetObject();
+    RAPIDJSON_NAMESPACE::Value::Object obj(value.GetObject());
+    push(reflectable, obj, allocator);
+}
+
+/*!
+ * \brief Pushes the specified integer/float/boolean to the specified value.
+ */
+template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
+inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.Set(reflectable, allocator);
+}
+
+/*!
+ * \brief Pushes the specified enumeration item to the specified value.
+ */
+template <typename Type, Traits::EnableIf<std::is_enum<Type>, Traits::Not<JsonEnumByName<Type>>> * = nullptr>
+inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.Set(static_cast<Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>>(reflectable),
+        allocator);
+}
+
+/*!
+ * \brief Pushes the name of the specified enumeration item to the specified value.
+ * \remarks Values without name are pushed as their underlying integer value.
+ */
+template <typename Type, Traits::EnableIf<std::is_enum<Type>, JsonEnumByName<Type>> * = nullptr>
+inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    const auto name = JsonEnumNames<Type>::name(reflectable);
+    if (name.name.empty()) {
+        value.Set(static_cast<Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>>(reflectable),
+            allocator);
+        return;
+    }
+    value.SetString(RAPIDJSON_NAMESPACE::StringRef(name.name.data(), rapidJsonSize(name.name.size())));
+}
+
+/*!
+ * \brief Pushes the specified C-string to the specified value.
+ */
+template <typename Type, Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>> * = nullptr>
+inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    if (reflectable) {
+        value.SetString(reflectable, allocator);
+    } else {
+        value.SetNull();
+    }
+}
+
+/*!
+ * \brief Pushes the specified C-string to the specified value.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string_view>> * = nullptr>
+inline void push(Type reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    if (reflectable.data()) {
+        value.SetString(reflectable.data(), rapidJsonSize(reflectable.size()), allocator);
+    } else {
+        value.SetNull();
+    }
+}
+
+/*!
+ * \brief Pushes the specified std::string to the specified value.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+inline void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetString(reflectable.data(), rapidJsonSize(reflectable.size()), allocator);
+}
+
+/*!
+ * \brief Pushes the specified iteratable (eg. std::vector, std::list) to the specified value.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::HasSize<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetArray();
+    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
+    array.Reserve(reflectable.size(), allocator);
+    for (const auto &item : reflectable) {
+        push(item, array, allocator);
+    }
+}
+
+/*!
+ * \brief Pushes the specified iteratable list (eg. std::vector, std::list) to the specified value.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::HasSize<Type>>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetArray();
+    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
+    for (const auto &item : reflectable) {
+        push(item, array, allocator);
+    }
+}
+
+/*!
+ * \brief Pushes the specified map (std::map, std::unordered_map) to the specified value.
+ * \remarks Keys might be strings, integers or enums (see Detail::JsonMapKey).
+ */
+template <typename Type, Traits::EnableIfAny<IsMapOrHash<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetObject();
+    RAPIDJSON_NAMESPACE::Value::Object object(value.GetObject());
+    for (const auto &item : reflectable) {
+        RAPIDJSON_NAMESPACE::Value name = Detail::JsonMapKey<typename Type::key_type>(item.first).value(allocator), itemValue;
+        push(item.second, itemValue, allocator);
+        object.AddMember(name, itemValue, allocator);
+    }
+}
+
+/*!
+ * \brief Pushes the specified multimap (std::multimap, std::unordered_multimap) to the specified value.
+ * \remarks Values with the same key are grouped via equal_range() so the array for each key is created and filled only once
+ *          instead of looking up the member for each value. This relies on values with equivalent keys being adjacent which
+ *          is guaranteed for both, ordered and unordered multimaps.
+ */
+template <typename Type, Traits::EnableIfAny<IsMultiMapOrHash<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetObject();
+    for (auto i = reflectable.begin(), end = reflectable.end(); i != end;) {
+        const auto range = reflectable.equal_range(i->first);
+        auto arrayValue = RAPIDJSON_NAMESPACE::Value(RAPIDJSON_NAMESPACE::kArrayType);
+        RAPIDJSON_NAMESPACE::Value::Array array = arrayValue.GetArray();
+        array.Reserve(rapidJsonSize(static_cast<std::size_t>(std::distance(range.first, range.second))), allocator);
+        for (i = range.first; i != range.second; ++i) {
+            push(i->second, array, allocator);
+        }
+        RAPIDJSON_NAMESPACE::Value name = Detail::JsonMapKey<typename Type::key_type>(range.first->first).value(allocator);
+        value.AddMember(name, arrayValue, allocator);
+    }
+}
+
+namespace Detail {
+
+/*!
+ * \brief The TuplePushHelper class helps serializing tuples to JSON arrays.
+ */
+template <class Tuple, std::size_t N> struct TuplePushHelper {
+    static void push(const Tuple &tuple, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+    {
+        TuplePushHelper<Tuple, N - 1>::push(tuple, value, allocator);
+        JsonReflector::push(std::get<N - 1>(tuple), value, allocator);
+    }
+};
+
+template <class Tuple> struct TuplePushHelper<Tuple, 1> {
+    static void push(const Tuple &tuple, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+    {
+        JsonReflector::push(std::get<0>(tuple), value, allocator);
+    }
+};
+} // namespace Detail
+
+/*!
+ * \brief Pushes the specified tuple to the specified value.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetArray();
+    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
+    array.Reserve(std::tuple_size<Type>::value, allocator);
+    Detail::TuplePushHelper<Type, std::tuple_size<Type>::value>::push(reflectable, array, allocator);
+}
+
+/*!
+ * \brief Pushes the specified pair to the specified value.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    value.SetArray();
+    RAPIDJSON_NAMESPACE::Value::Array array(value.GetArray());
+    array.Reserve(2, allocator);
+    push(reflectable.first, array, allocator);
+    push(reflectable.second, array, allocator);
+}
+
+/*!
+ * \brief Pushes the specified unique_ptr, shared_ptr, weak_ptr or optional to the specified value.
+ */
+template <typename Type,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+        Traits::IsSpecializationOf<Type, std::weak_ptr>, Traits::IsSpecializationOf<Type, std::optional>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    if (!reflectable) {
+        value.SetNull();
+        return;
+    }
+    push(*reflectable, value, allocator);
+}
+
+/*!
+ * \brief Pushes the specified variant to the specified value.
+ */
+template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    if (reflectable.valueless_by_exception()) {
+        value.SetNull();
+        return;
+    }
+
+    RAPIDJSON_NAMESPACE::Value index, data;
+    index.SetInt(reflectable.index());
+    std::visit(
+        [&data, &allocator](const auto &reflectableOfActualType) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(reflectableOfActualType)>, std::monostate>) {
+                push(reflectableOfActualType, data, allocator);
+            } else {
+                CPP_UTILITIES_UNUSED(data)
+                CPP_UTILITIES_UNUSED(allocator)
+            }
+        },
+        reflectable);
+
+    value.SetObject();
+    value.AddMember("index", index, allocator);
+    value.AddMember("data", data, allocator);
+}
+
+/*!
+ * \brief Pushes the specified \a reflectable which has a custom type to the specified array.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> *>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
+    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
+    push(reflectable, object, allocator);
+    value.PushBack(objectValue, allocator);
+}
+
+/*!
+ * \brief Pushes the specified \a reflectable to the specified array.
+ */
+template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> *>
+void push(const Type &reflectable, RAPIDJSON_NAMESPACE::Value::Array &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value genericValue;
+    push(reflectable, genericValue, allocator);
+    value.PushBack(genericValue, allocator);
+}
+
+/*!
+ * \brief Pushes the specified \a reflectable which has custom type as a member to the specified object.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> *>
+void push(const Type &reflectable, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
+    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
+    push(reflectable, object, allocator);
+    value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name.name.data(), rapidJsonSize(name.name.size())), objectValue, allocator);
+}
+
+/*!
+ * \brief Pushes the specified \a reflectable as a member to the specified object.
+ */
+template <typename Type, Traits::DisableIf<IsJsonSerializable<Type>> *>
+void push(const Type &reflectable, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value genericValue;
+    push(reflectable, genericValue, allocator);
+    value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name.name.data(), rapidJsonSize(name.name.size())), genericValue, allocator);
+}
+
+/*!
+ * \brief Pushes the specified \a reflectable as a member with the specified null-terminated \a name to the specified object.
+ * \remarks The length of \a name is determined at runtime. The generated code uses the JsonMemberName overload instead.
+ */
+template <typename Type>
+void push(
+    const Type &reflectable, const char *name, RAPIDJSON_NAMESPACE::Value::Object &value, RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    push(reflectable, JsonMemberName{ name, std::string_view() }, value, allocator);
+}
+
+// define functions to "push" only the differences ("delta") between two values as JSON merge patch (RFC 7386)
+
+/*!
+ * \brief Pushes the members of the \a reflectable which has a custom type differing from the \a baseline to the specified object.
+ * \remarks The definition of this function must be provided by the code generator or Boost.Hana.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void pushDelta(const Type &reflectable, const Type &baseline, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the differences between the \a reflectable which has a custom type and the \a baseline as a member to the specified object.
+ * \remarks The member is only added if at least one of the nested members differs.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+void pushDelta(const Type &reflectable, const Type &baseline, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+/*!
+ * \brief Pushes the differences between the map \a reflectable and the \a baseline as a member to the specified object.
+ * \remarks Keys missing in \a reflectable are pushed as null. The member is only added if there is at least one difference.
+ */
+template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr>
+void pushDelta(const Type &reflectable, const Type &baseline, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);
+
+namespace Detail {
+
+/*!
+ * \brief Checks whether operator== is well-formed for \tparam Type.
+ * \remarks The operator== of std containers, tuples and variants is unconstrained so this is only meaningful for other types.
+ */
+template <typename Type, typename = void> struct IsEqualityComparable : Traits::Bool<false> {};
+template <typename Type>
+struct IsEqualityComparable<Type, std::void_t<decltype(std::declval<const Type &>() == std::declval<const Type &>())>> : Traits::Bool<true> {};
+
+/*!
+ * \brief Returns whether the specified values are equal as far as pushDelta() is concerned.
+ * \remarks
+ * - Pointers and optionals are compared by their pointees, containers, tuples and variants element-wise.
+ * - Maps and sets are compared regardless of their iteration order so unordered containers holding the same elements are equal.
+ * - Other types are compared via operator== if it is well-formed; otherwise their JSON representation is compared as last resort.
+ */
+template <typename Type> bool isEqualForDelta(const Type &reflectable, const Type &baseline)
+{
+    if constexpr (std::is_arithmetic_v<Type> || std::is_enum_v<Type> || std::is_same_v<Type, std::string>
+        || std::is_same_v<Type, std::string_view>) {
+        return reflectable == baseline;
+    } else if constexpr (std::is_same_v<Type, const char *> || std::is_same_v<Type, char *>) {
+        return (!reflectable || !baseline) ? !reflectable == !baseline : std::string_view(reflectable) == std::string_view(baseline);
+    } else if constexpr (Traits::IsSpecializationOf<Type, std::weak_ptr>::value) {
+        return isEqualForDelta(reflectable.lock(), baseline.lock());
+    } else if constexpr (Traits::IsSpecializingAnyOf<Type, std::optional, std::unique_ptr, std::shared_ptr>::value) {
+        return (!reflectable || !baseline) ? !reflectable == !baseline : isEqualForDelta(*reflectable, *baseline);
+    } else if constexpr (IsMapOrHash<Type>::value || IsMultiMapOrHash<Type>::value) {
+        if (reflectable.size() != baseline.size()) {
+            return false;
+        }
+        const auto isEqualMapped = [](const auto &lhs, const auto &rhs) { return isEqualForDelta(lhs.second, rhs.second); };
+        for (auto i = reflectable.begin(), end = reflectable.end(); i != end;) {
+            const auto group = reflectable.equal_range(i->first);
+            const auto baselineGroup = baseline.equal_range(i->first);
+            if (std::distance(group.first, group.second) != std::distance(baselineGroup.first, baselineGroup.second)
+                || !std::is_permutation(group.first, group.second, baselineGroup.first, isEqualMapped)) {
+                return false;
+            }
+            i = group.second;
+        }
+        return true;
+    } else if constexpr (IsSet<Type>::value || IsMultiSet<Type>::value) {
+        return reflectable.size() == baseline.size()
+            && std::all_of(reflectable.begin(), reflectable.end(),
+                [&](const auto &element) { return reflectable.count(element) == baseline.count(element); });
+    } else if constexpr (IsArray<Type>::value) {
+        return std::equal(reflectable.begin(), reflectable.end(), baseline.begin(), baseline.end(),
+            [](const auto &lhs, const auto &rhs) { return isEqualForDelta(lhs, rhs); });
+    } else if constexpr (Traits::IsSpecializingAnyOf<Type, std::tuple, std::pair>::value) {
+        return std::apply(
+            [&baseline](const auto &...elements) {
+                return std::apply([&elements...](const auto &...baselineElements) { return (isEqualForDelta(elements, baselineElements) && ...); },
+                    baseline);
+            },
+            reflectable);
+    } else if constexpr (IsVariant<Type>::value) {
+        return reflectable.index() == baseline.index()
+            && std::visit(
+                [](const auto &alternative, const auto &baselineAlternative) {
+                    if constexpr (std::is_same_v<decltype(alternative), decltype(baselineAlternative)>) {
+                        return isEqualForDelta(alternative, baselineAlternative);
+                    } else {
+                        return false;
+                    }
+                },
+                reflectable, baseline);
+    } else if constexpr (IsEqualityComparable<Type>::value) {
+        return reflectable == baseline;
+    } else {
+        RAPIDJSON_NAMESPACE::Document::AllocatorType allocator;
+        RAPIDJSON_NAMESPACE::Value value, baselineValue;
+        push(reflectable, value, allocator);
+        push(baseline, baselineValue, allocator);
+        return value == baselineValue;
+    }
+}
+
+} // namespace Detail
+
+/*!
+ * \brief Pushes the \a reflectable as a member to the specified object if it differs from the \a baseline.
+ * \remarks Values which are neither maps nor have a custom type are always pushed as a whole so arrays are replaced as a whole
+ *          when applying the delta as merge patch.
+ */
+template <typename Type, Traits::DisableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>> * = nullptr>
+void pushDelta(const Type &reflectable, const Type &baseline, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    if (!Detail::isEqualForDelta(reflectable, baseline)) {
+        push(reflectable, name, value, allocator);
+    }
+}
+
+/*!
+ * \brief Pushes the differences between the \a reflectable which has a custom type and the \a baseline as a member to the specified object.
+ * \remarks The member is only added if at least one of the nested members differs.
+ */
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> *>
+void pushDelta(const Type &reflectable, const Type &baseline, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
+    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
+    pushDelta(reflectable, baseline, object, allocator);
+    if (!object.ObjectEmpty()) {
+        value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name.name.data(), rapidJsonSize(name.name.size())), objectValue, allocator);
+    }
+}
+
+/*!
+ * \brief Pushes the differences between the map \a reflectable and the \a baseline as a member to the specified object.
+ * \remarks Keys missing in \a reflectable are pushed as null. The member is only added if there is at least one difference.
+ */
+template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> *>
+void pushDelta(const Type &reflectable, const Type &baseline, JsonMemberName name, RAPIDJSON_NAMESPACE::Value::Object &value,
+    RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+{
+    RAPIDJSON_NAMESPACE::Value objectValue(RAPIDJSON_NAMESPACE::kObjectType);
+    RAPIDJSON_NAMESPACE::Value::Object object(objectValue.GetObject());
+    for (const auto &item : reflectable) {
+        const auto key = Detail::JsonMapKey<typename Type::key_type>(item.first);
+        const auto baselineItem = baseline.find(item.first);
+        if (baselineItem == baseline.end()) {
+            RAPIDJSON_NAMESPACE::Value name = key.value(allocator), itemValue;
+            push(item.second, itemValue, allocator);
+            object.AddMember(name, itemValue, allocator);
+            continue;
+        }
+        const auto memberCount = object.MemberCount();
+        pushDelta(item.second, baselineItem->second, JsonMemberName{ key.name(), std::string_view() }, object, allocator);
+        if (object.MemberCount() != memberCount) {
+            // the name might refer to the buffer of the key; so replace it with a name owned by the document if required
+            (object.MemberEnd() - 1)->name = key.value(allocator);
+        }
+    }
+    for (const auto &baselineItem : baseline) {
+        if (reflectable.find(baselineItem.first) == reflectable.end()) {
+            RAPIDJSON_NAMESPACE::Value name = Detail::JsonMapKey<typename Type::key_type>(baselineItem.first).value(allocator), nullValue;
+            object.AddMember(name, nullValue, allocator);
+        }
+    }
+    if (!object.ObjectEmpty()) {
+        value.AddMember(RAPIDJSON_NAMESPACE::StringRef(name.name.data(), rapidJsonSize(name.name.size())), objectValue, allocator);
+    }
+}
+
+// define functions to "write" values directly to a RapidJSON writer (without building a document first)
+
+/*!
+ * \brief The JsonMembers struct provides the functions to write, read and merge-patch the members of \tparam Type which has a
+ *        custom type via a writer/reader (without building a document first).
+ * \remarks The definition of this struct must be provided by the code generator or Boost.Hana. It contains:
+ *          - `template <typename Writer> static void writeMembers(const Type &reflectable, Writer &writer)` writing all members
+ *          - `template <typename Writer> static void writeMembersWithoutDefaults(const Type &reflectable, const Type &defaults,
+ *            Writer &writer)` writing all members which differ from the corresponding members of \a defaults (see
+ *            writeWithoutDefault())
+ *          - `template <typename Reader> static bool readMember(Type &reflectable, std::string_view name, Reader &reader,
+ *            JsonDeserializationErrors *errors)` reading the member with the specified name which the reader is positioned at
+ *            the key of; returns whether \a name denotes a member (if not, the reader must not be advanced)
+ *          - `template <typename Reader> static bool mergePatchMember(...)` taking the same arguments as readMember() but applying
+ *            the merge patch for the member (see mergePatch())
+ * \remarks The functions are templated on the writer/reader so the flags of the policy can be used (see BasicJsonWriter and
+ *          BasicJsonReader). A struct is used because function templates can not be specialized only for \tparam Type.
+ */
+template <typename Type, typename = void> struct JsonMembers;
+
+/*!
+ * \brief The HasJsonMembers class checks whether a JsonMembers specialization is available for \tparam Type.
+ * \remarks This is an explicit opt-in which must be specialized (to Traits::Bool<true>) along with JsonMembers by the code
+ *          generator or Boost.Hana. Types without it (e.g. types with custom serialization only specializing push()) are
+ *          written via push() instead.
+ */
+template <typename Type, typename = void> struct HasJsonMembers : public Traits::Bool<false> {};
+
+/*!
+ * \brief Writes the specified \a reflectable which has a custom type as object to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr> void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified iteratable (eg. std::vector, std::list, std::set) as array to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsArrayOrSet<Type>> * = nullptr> void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified map (std::map, std::unordered_map) as object to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr> void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified multimap (std::multimap, std::unordered_multimap) as object of arrays to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsMultiMapOrHash<Type>> * = nullptr> void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified tuple or pair as array to the specified writer.
+ */
+template <typename Type, typename Writer,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
+void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified unique_ptr, shared_ptr, weak_ptr or optional to the specified writer.
+ */
+template <typename Type, typename Writer,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+        Traits::IsSpecializationOf<Type, std::weak_ptr>, Traits::IsSpecializationOf<Type, std::optional>> * = nullptr>
+void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified variant to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsVariant<Type>> * = nullptr> void write(const Type &reflectable, Writer &writer);
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified \a name to the specified writer.
+ * \remarks The writer is supposed to be within an object.
+ */
+template <typename Type, typename Writer> void write(const Type &reflectable, JsonMemberName name, Writer &writer);
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified null-terminated \a name to the specified writer.
+ * \remarks The writer is supposed to be within an object.
+ */
+template <typename Type, typename Writer> void write(const Type &reflectable, const char *name, Writer &writer);
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified \a name to the specified writer unless it equals the
+ *        specified \a defaultValue.
+ * \remarks The writer is supposed to be within an object.
+ */
+template <typename Type, typename Writer>
+void writeWithoutDefault(const Type &reflectable, const Type &defaultValue, JsonMemberName name, Writer &writer);
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified null-terminated \a name to the specified writer unless it
+ *        equals the specified \a defaultValue.
+ * \remarks The writer is supposed to be within an object.
+ */
+template <typename Type, typename Writer>
+void writeWithoutDefault(const Type &reflectable, const Type &defaultValue, const char *name, Writer &writer);
+
+/*!
+ * \brief Writes the specified integer/float/boolean to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
+inline void write(Type reflectable, Writer &writer)
+{
+    if constexpr (std::is_same_v<Type, bool>) {
+        writer.Bool(reflectable);
+    } else if constexpr (std::is_floating_point_v<Type>) {
+        writer.Double(static_cast<double>(reflectable));
+    } else if constexpr (std::is_signed_v<Type>) {
+        writer.Int64(static_cast<std::int64_t>(reflectable));
+    } else {
+        writer.Uint64(static_cast<std::uint64_t>(reflectable));
+    }
+}
+
+/*!
+ * \brief Writes the specified enumeration item as its underlying integer value to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<std::is_enum<Type>, Traits::Not<JsonEnumByName<Type>>> * = nullptr>
+inline void write(Type reflectable, Writer &writer)
+{
+    if constexpr (std::is_unsigned_v<typename std::underlying_type<Type>::type>) {
+        writer.Uint64(static_cast<std::uint64_t>(reflectable));
+    } else {
+        writer.Int64(static_cast<std::int64_t>(reflectable));
+    }
+}
+
+/*!
+ * \brief Writes the name of the specified enumeration item to the specified writer.
+ * \remarks The quoted name is written as-is. Values without name are written as their underlying integer value.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<std::is_enum<Type>, JsonEnumByName<Type>> * = nullptr>
+inline void write(Type reflectable, Writer &writer)
+{
+    const auto name = JsonEnumNames<Type>::name(reflectable);
+    if (!name.quotedName.empty()) {
+        writer.RawValue(name.quotedName.data(), name.quotedName.size(), RAPIDJSON_NAMESPACE::kStringType);
+    } else if (!name.name.empty()) {
+        writer.String(name.name.data(), rapidJsonSize(name.name.size()));
+    } else if constexpr (std::is_unsigned_v<typename std::underlying_type<Type>::type>) {
+        writer.Uint64(static_cast<std::uint64_t>(reflectable));
+    } else {
+        writer.Int64(static_cast<std::int64_t>(reflectable));
+    }
+}
+
+/*!
+ * \brief Writes the specified C-string to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>> * = nullptr>
+inline void write(Type reflectable, Writer &writer)
+{
+    if (reflectable) {
+        writer.String(reflectable, rapidJsonSize(std::strlen(reflectable)));
+    } else {
+        writer.Null();
+    }
+}
+
+/*!
+ * \brief Writes the specified std::string_view to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<std::is_same<Type, std::string_view>> * = nullptr>
+inline void write(Type reflectable, Writer &writer)
+{
+    if (reflectable.data()) {
+        writer.String(reflectable.data(), rapidJsonSize(reflectable.size()));
+    } else {
+        writer.Null();
+    }
+}
+
+/*!
+ * \brief Writes the specified std::string to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+inline void write(const Type &reflectable, Writer &writer)
+{
+    writer.String(reflectable.data(), rapidJsonSize(reflectable.size()));
+}
+
+/*!
+ * \brief Writes the specified \a reflectable which has a custom type as object to the specified writer.
+ * \remarks Types without JsonMembers specialization (see HasJsonMembers) are pushed to an intermediate value which is
+ *          written afterwards.
+ */
+template <typename Type, typename Writer, Traits::DisableIf<IsBuiltInType<Type>> *> void write(const Type &reflectable, Writer &writer)
+{
+    if constexpr (HasJsonMembers<Type>::value) {
+        writer.StartObject();
+        JsonMembers<Type>::writeMembers(reflectable, writer);
+        writer.EndObject();
+    } else {
+        RAPIDJSON_NAMESPACE::Document::AllocatorType allocator;
+        RAPIDJSON_NAMESPACE::Value value;
+        push(reflectable, value, allocator);
+        value.Accept(writer);
+    }
+}
+
+/*!
+ * \brief Writes the specified iteratable (eg. std::vector, std::list, std::set) as array to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsArrayOrSet<Type>> *> void write(const Type &reflectable, Writer &writer)
+{
+    writer.StartArray();
+    for (const auto &item : reflectable) {
+        write(item, writer);
+    }
+    writer.EndArray();
+}
+
+/*!
+ * \brief Writes the specified map (std::map, std::unordered_map) as object to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsMapOrHash<Type>> *> void write(const Type &reflectable, Writer &writer)
+{
+    writer.StartObject();
+    for (const auto &item : reflectable) {
+        const auto key = Detail::JsonMapKey<typename Type::key_type>(item.first);
+        writer.Key(key.name().data(), rapidJsonSize(key.name().size()));
+        write(item.second, writer);
+    }
+    writer.EndObject();
+}
+
+/*!
+ * \brief Writes the specified multimap (std::multimap, std::unordered_multimap) as object of arrays to the specified writer.
+ * \remarks Values with the same key are grouped via equal_range() so each key is only written once.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsMultiMapOrHash<Type>> *> void write(const Type &reflectable, Writer &writer)
+{
+    writer.StartObject();
+    for (auto i = reflectable.begin(), end = reflectable.end(); i != end;) {
+        const auto range = reflectable.equal_range(i->first);
+        const auto key = Detail::JsonMapKey<typename Type::key_type>(i->first);
+        writer.Key(key.name().data(), rapidJsonSize(key.name().size()));
+        writer.StartArray();
+        for (i = range.first; i != range.second; ++i) {
+            write(i->second, writer);
+        }
+        writer.EndArray();
+    }
+    writer.EndObject();
+}
+
+/*!
+ * \brief Writes the specified tuple or pair as array to the specified writer.
+ */
+template <typename Type, typename Writer,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>> *>
+void write(const Type &reflectable, Writer &writer)
+{
+    writer.StartArray();
+    std::apply([&writer](const auto &... elements) { (write(elements, writer), ...); }, reflectable);
+    writer.EndArray();
+}
+
+/*!
+ * \brief Writes the specified unique_ptr, shared_ptr, weak_ptr or optional to the specified writer.
+ */
+template <typename Type, typename Writer,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+        Traits::IsSpecializationOf<Type, std::weak_ptr>, Traits::IsSpecializationOf<Type, std::optional>> *>
+void write(const Type &reflectable, Writer &writer)
+{
+    if (!reflectable) {
+        writer.Null();
+        return;
+    }
+    write(*reflectable, writer);
+}
+
+/*!
+ * \brief Writes the specified variant to the specified writer.
+ */
+template <typename Type, typename Writer, Traits::EnableIf<IsVariant<Type>> *> void write(const Type &reflectable, Writer &writer)
+{
+    if (reflectable.valueless_by_exception()) {
+        writer.Null();
+        return;
+    }
+
+    writer.StartObject();
+    writer.Key("index", 5);
+    writer.Int(static_cast<int>(reflectable.index()));
+    writer.Key("data", 4);
+    std::visit(
+        [&writer](const auto &reflectableOfActualType) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(reflectableOfActualType)>, std::monostate>) {
+                write(reflectableOfActualType, writer);
+            } else {
+                writer.Null();
+            }
+        },
+        reflectable);
+    writer.EndObject();
+}
+
+namespace Detail {
+
+/*!
+ * \brief Writes the key of a member with the specified \a name to the specified writer.
+ * \remarks If the quoted name is known it is written as-is so the name does not need to be escaped again.
+ */
+template <typename Writer> inline void writeMemberName(JsonMemberName name, Writer &writer)
+{
+    if (name.quotedName.empty()) {
+        writer.Key(name.name.data(), rapidJsonSize(name.name.size()));
+    } else {
+        writer.RawValue(name.quotedName.data(), name.quotedName.size(), RAPIDJSON_NAMESPACE::kStringType);
+    }
+}
+
+} // namespace Detail
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified \a name to the specified writer.
+ * \remarks The writer is supposed to be within an object. If the quoted name is known it is written as-is so the name
+ *          does not need to be escaped again.
+ */
+template <typename Type, typename Writer> void write(const Type &reflectable, JsonMemberName name, Writer &writer)
+{
+    Detail::writeMemberName(name, writer);
+    write(reflectable, writer);
+}
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified null-terminated \a name to the specified writer.
+ * \remarks The writer is supposed to be within an object. The length of \a name is determined at runtime. The generated code
+ *          uses the JsonMemberName overload instead.
+ */
+template <typename Type, typename Writer> void write(const Type &reflectable, const char *name, Writer &writer)
+{
+    write(reflectable, JsonMemberName{ name, std::string_view() }, writer);
+}
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified \a name to the specified writer unless it equals the
+ *        specified \a defaultValue.
+ * \remarks Values are compared via Detail::isEqualForDelta(). Custom types with JsonMembers specialization are not compared as a
+ *          whole (unless they provide operator==) but written as object containing only their members which differ from the
+ *          ones of \a defaultValue. Such an object is written into a separate buffer first and skipped if none of its members has
+ *          been written. So no intermediate JSON document is built.
+ * \remarks Other values (including maps) are written as a whole if they differ. Unlike toJsonDelta(), null is never written.
+ */
+template <typename Type, typename Writer>
+void writeWithoutDefault(const Type &reflectable, const Type &defaultValue, JsonMemberName name, Writer &writer)
+{
+    if constexpr (HasJsonMembers<Type>::value && Detail::IsEqualityComparable<Type>::value) {
+        if (reflectable == defaultValue) {
+            return;
+        }
+        Detail::writeMemberName(name, writer);
+        writer.StartObject();
+        JsonMembers<Type>::writeMembersWithoutDefaults(reflectable, defaultValue, writer);
+        writer.EndObject();
+    } else if constexpr (HasJsonMembers<Type>::value) {
+        RAPIDJSON_NAMESPACE::StringBuffer buffer;
+        {
+            JsonStringBufferOutputStream stream(buffer);
+            Writer objectWriter(stream);
+            objectWriter.SetMaxDecimalPlaces(writer.GetMaxDecimalPlaces());
+            objectWriter.StartObject();
+            JsonMembers<Type>::writeMembersWithoutDefaults(reflectable, defaultValue, objectWriter);
+            objectWriter.EndObject();
+        }
+        // skip the member if the object is empty ("{}") because all of its members are equal to their default value
+        if (buffer.GetSize() > 2) {
+            Detail::writeMemberName(name, writer);
+            writer.RawValue(buffer.GetString(), buffer.GetSize(), RAPIDJSON_NAMESPACE::kObjectType);
+        }
+    } else {
+        if (Detail::isEqualForDelta(reflectable, defaultValue)) {
+            return;
+        }
+        write(reflectable, name, writer);
+    }
+}
+
+/*!
+ * \brief Writes the specified \a reflectable as member with the specified null-terminated \a name to the specified writer unless it
+ *        equals the specified \a defaultValue.
+ * \remarks See the JsonMemberName overload for details.
+ */
+template <typename Type, typename Writer>
+void writeWithoutDefault(const Type &reflectable, const Type &defaultValue, const char *name, Writer &writer)
+{
+    writeWithoutDefault(reflectable, defaultValue, JsonMemberName{ name, std::string_view() }, writer);
+}
+
+// define functions to "pull" values from a RapidJSON array or object
+
+/*!
+ * \brief Pulls the \a reflectable which has a custom type from the specified object.
+ * \remarks The definition of this function must be provided by the code generator or Boost.Hana.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
+    JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the member with the specified \a name of the \a reflectable which has a custom type from the specified \a value of
+ *        that member.
+ * \returns Returns whether \a name denotes a member of \a reflectable (including members of its base classes).
+ * \remarks The definition of this function must be provided by the code generator. It allows pull() to dispatch the members of
+ *          base classes within the same loop over the object's members (like JsonMembers::readMember() does for read()).
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+bool pullMember(Type &reflectable, std::string_view name, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value,
+    JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an iteratable without reserve() method from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::IsReservable<Type>>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an iteratable with reserve() method from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::IsReservable<Type>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an array/vector/list from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a set from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsSet<Type>> * = nullptr>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a multiset from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsMultiSet<Type>> * = nullptr>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a map from the specified value which is checked to contain an object.
+ */
+template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a multimap from the specified value which is checked to contain an object.
+ */
+template <typename Type, Traits::EnableIf<IsMultiMapOrHash<Type>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a tuple from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a pair from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a unique_ptr from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a shared_ptr from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an optional from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::optional>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a variant from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<IsVariant<Type>> * = nullptr>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified \a reflectable from the specified value iterator which is checked to contain the right type.
+ */
+template <typename Type>
+inline void pull(
+    Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ValueIterator &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified member of \a reflectable which has a custom type from the specified object.
+ * \remarks It is checked whether the object actually contains the member. If not, the missing member is ignored. So currently all members
+ *          are optional.
+ */
+template <typename Type>
+inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
+    JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the specified member of \a reflectable from the specified \a value of that member.
+ * \remarks This is used by the generated code which iterates over the members of an object only once instead of looking
+ *          up each member by its name.
+ */
+template <typename Type>
+inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value,
+    JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
+void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Pulls the integer or float from the specified value which is supposed and checked to contain the right type.
+ */
+template <typename Type,
+    Traits::EnableIf<Traits::Not<std::is_same<Type, bool>>, Traits::Any<std::is_integral<Type>, std::is_floating_point<Type>>> * = nullptr>
+inline void pull(
+    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsNumber()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    reflectable = value.Is<Type>() ? value.Get<Type>() : static_cast<Type>(value.GetDouble());
+}
+
+/*!
+ * \brief Pulls the boolean from the specified value which is supposed and checked to contain the right type.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, bool>> * = nullptr>
+inline void pull(
+    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsBool()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    reflectable = value.GetBool();
+}
+
+/*!
+ * \brief Pulls the specified enumeration item from the specified value which is supposed and checked to be compatible with the underlying type.
+ * \remarks It is *not* checked, whether \a value is actually a valid enum item.
+ */
+template <typename Type, Traits::EnableIf<std::is_enum<Type>, Traits::Not<JsonEnumByName<Type>>> * = nullptr>
+inline void pull(
+    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    using ExpectedType = Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>;
+    if (!value.Is<ExpectedType>()) {
+        if (errors) {
+            errors->reportTypeMismatch<ExpectedType>(value.GetType());
+        }
+        return;
+    }
+    reflectable = static_cast<Type>(value.Get<ExpectedType>());
+}
+
+/*!
+ * \brief Pulls the specified enumeration item from the specified value which is supposed and checked to contain the name of an enumerator.
+ * \remarks Unknown names are reported as conversion error. Numbers are accepted as well (like when not serializing by name) because
+ *          push() falls back to the underlying integer value for values without name.
+ */
+template <typename Type, Traits::EnableIf<std::is_enum<Type>, JsonEnumByName<Type>> * = nullptr>
+inline void pull(
+    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (value.IsNumber()) {
+        using ExpectedType = Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>;
+        if (!value.Is<ExpectedType>()) {
+            if (errors) {
+                errors->reportTypeMismatch<ExpectedType>(value.GetType());
+            }
+            return;
+        }
+        reflectable = static_cast<Type>(value.Get<ExpectedType>());
+        return;
+    }
+    if (!value.IsString()) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(value.GetType());
+        }
+        return;
+    }
+    if (const auto *const enumValue = enumValueByName<Type>(std::string_view(value.GetString(), value.GetStringLength()))) {
+        reflectable = *enumValue;
+    } else if (errors) {
+        errors->reportConversionError(JsonType::String);
+    }
+}
+
+/*!
+ * \brief Pulls the std::string from the specified value which is supposed and checked to contain a string.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+inline void pull(
+    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsString()) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(value.GetType());
+        }
+        return;
+    }
+    reflectable = value.GetString();
+}
+
+/*!
+ * \brief Checks whether the specified value contains a string.
+ * \remarks Does not actually store the value since the ownership would not be clear (see README.md).
+ */
+template <typename Type,
+    Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>, std::is_same<Type, std::string_view>> * = nullptr>
+inline void pull(Type &, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsString()) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(value.GetType());
+        }
+        return;
+    }
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an iteratable without reserve() method from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::IsReservable<Type>>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsArray()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    pull(reflectable, value.GetArray(), errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an iteratable with reserve() method from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::IsReservable<Type>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsArray()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    auto array = value.GetArray();
+    reflectable.reserve(array.Size());
+    pull(reflectable, array, errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an array/vector/list from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsArray<Type>> *>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+{
+    // clear previous contents of the array
+    reflectable.clear();
+
+    // pull all array elements of the specified value
+    std::size_t index = 0;
+    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
+        // set error context for current index
+        if (errors) {
+            errors->currentIndex = index;
+        }
+        ++index;
+        reflectable.emplace_back();
+        pull(reflectable.back(), item, errors);
+    }
+
+    // clear error context
+    if (errors) {
+        errors->currentIndex = JsonDeserializationError::noIndex;
+    }
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a resizable array/vector from the specified array using multiple threads.
+ * \remarks The \a reflectable is resized to the size of the \a array and consecutive slices of its elements are pulled in
+ *          parallel by \a threadCount threads (or std::thread::hardware_concurrency() threads if 0). Each thread reports errors
+ *          to its own JsonDeserializationErrors object which are appended to \a errors in order afterwards. The currentIndex
+ *          of these errors is the index within the whole \a array (as if pulled serially).
+ * \remarks If throwOn is set and a fatal error occurs in multiple slices, the first one is thrown after all threads have
+ *          finished. Errors of subsequent slices are not appended in this case.
+ * \remarks This is only worthwhile for big arrays of expensive elements; use fromJsonParallel() to opt-in.
+ */
+template <typename Type,
+    Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>, Traits::Not<std::is_same<typename Type::value_type, bool>>> * = nullptr>
+void pullParallel(Type &reflectable, RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array,
+    JsonDeserializationErrors *errors, std::size_t threadCount = 0)
+{
+    // determine slices; fallback to pulling serially if only one thread would be used
+    const auto size = static_cast<std::size_t>(array.Size());
+    if (!threadCount) {
+        threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threadCount = std::min(threadCount, size);
+    if (threadCount <= 1) {
+        pull(reflectable, array, errors);
+        return;
+    }
+    const auto sliceSize = size / threadCount, remainder = size % threadCount;
+
+    // pre-size the array so each thread can pull its elements in-place
+    reflectable.clear();
+    reflectable.resize(size);
+
+    // pull slices in parallel; pull the first slice in the calling thread
+    auto sliceErrors = std::vector<JsonDeserializationErrors>(errors ? threadCount : 0);
+    for (auto &errorsOfSlice : sliceErrors) {
+        errorsOfSlice.currentRecord = errors->currentRecord;
+        errorsOfSlice.currentMember = errors->currentMember;
+        errorsOfSlice.throwOn = errors->throwOn;
+    }
+    const auto pullSlice = [&reflectable, &array](std::size_t begin, std::size_t end, JsonDeserializationErrors *errorsOfSlice) {
+        for (auto index = begin; index != end; ++index) {
+            if (errorsOfSlice) {
+                errorsOfSlice->currentIndex = index;
+            }
+            pull(reflectable[index], array[static_cast<RAPIDJSON_NAMESPACE::SizeType>(index)], errorsOfSlice);
+        }
+    };
+    auto futures = std::vector<std::future<void>>();
+    futures.reserve(threadCount);
+    auto sliceBegin = sliceSize + (remainder ? 1 : 0);
+    for (std::size_t slice = 1; slice != threadCount; ++slice) {
+        const auto sliceEnd = sliceBegin + sliceSize + (slice < remainder ? 1 : 0);
+        futures.emplace_back(std::async(std::launch::async, pullSlice, sliceBegin, sliceEnd, errors ? &sliceErrors[slice] : nullptr));
+        sliceBegin = sliceEnd;
+    }
+    std::exception_ptr firstException;
+    try {
+        pullSlice(0, sliceSize + (remainder ? 1 : 0), errors ? &sliceErrors[0] : nullptr);
+    } catch (...) {
+        firstException = std::current_exception();
+    }
+    auto lastSlice = firstException ? std::size_t(0) : threadCount - 1;
+    for (std::size_t slice = 1; slice != threadCount; ++slice) {
+        try {
+            futures[slice - 1].get();
+        } catch (...) {
+            if (!firstException) {
+                firstException = std::current_exception();
+                lastSlice = slice;
+            }
+        }
+    }
+
+    // merge errors in order and clear error context
+    if (errors) {
+        for (std::size_t slice = 0; slice <= lastSlice; ++slice) {
+            errors->insert(errors->end(), sliceErrors[slice].begin(), sliceErrors[slice].end());
+        }
+        errors->currentIndex = JsonDeserializationError::noIndex;
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a multiset from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsMultiSet<Type>> *>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+{
+    // clear previous contents of the array
+    reflectable.clear();
+
+    // pull all array elements of the specified value
+    std::size_t index = 0;
+    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
+        // set error context for current index
+        if (errors) {
+            errors->currentIndex = index;
+        }
+        ++index;
+        typename Type::value_type itemObj;
+        pull(itemObj, item, errors);
+        reflectable.emplace(move(itemObj));
+    }
+
+    // clear error context
+    if (errors) {
+        errors->currentIndex = JsonDeserializationError::noIndex;
+    }
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a set from the specified array. The \a reflectable is cleared before.
+ */
+template <typename Type, Traits::EnableIf<IsSet<Type>> *>
+void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+{
+    // clear previous contents of the array
+    reflectable.clear();
+
+    // pull all array elements of the specified value
+    std::size_t index = 0;
+    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
+        // set error context for current index
+        if (errors) {
+            errors->currentIndex = index;
+        }
+        ++index;
+        typename Type::value_type itemObj;
+        pull(itemObj, item, errors);
+        if (!reflectable.emplace(move(itemObj)).second) {
+            errors->reportUnexpectedDuplicate(JsonType::Array);
+        }
+    }
+
+    // clear error context
+    if (errors) {
+        errors->currentIndex = JsonDeserializationError::noIndex;
+    }
+}
+
+namespace Detail {
+
+/*!
+ * \brief The HasHeterogeneousLookup class checks whether the specified map can be searched by std::string_view without
+ *        constructing a key first (eg. std::map<std::string, T, std::less<>>).
+ */
+template <typename Type, typename = void> struct HasHeterogeneousLookup : Traits::Bool<false> {
+};
+template <typename Type>
+struct HasHeterogeneousLookup<Type, std::void_t<decltype(std::declval<Type &>().find(std::declval<std::string_view>()))>> : Traits::Bool<true> {
+};
+
+/*!
+ * \brief Parses the key of a map from the specified JSON member \a name (see JsonMapKey).
+ * \returns Returns whether \a name could be converted; otherwise a ConversionError is reported.
+ */
+template <typename Key> inline bool parseMapKey(std::string_view name, Key &key, JsonDeserializationErrors *errors)
+{
+    if (JsonMapKey<Key>::parse(name, key)) {
+        return true;
+    }
+    if (errors) {
+        errors->reportConversionError(JsonType::String);
+    }
+    return false;
+}
+
+/*!
+ * \brief Returns the value for the specified member \a name within the specified \a map, inserting a default-constructed value
+ *        if the key is not present yet.
+ * \returns Returns nullptr if \a name can not be converted to the key type of the map.
+ * \remarks The key is constructed from data and length (so no strlen() is required) and only if it is not present yet in case
+ *          the map supports heterogeneous lookup.
+ */
+template <typename Type>
+inline typename Type::mapped_type *mapValueForKey(Type &map, std::string_view name, JsonDeserializationErrors *errors)
+{
+    if constexpr (HasHeterogeneousLookup<Type>::value) {
+        if (const auto i = map.find(name); i != map.end()) {
+            return &i->second;
+        }
+    }
+    auto key = typename Type::key_type();
+    return parseMapKey(name, key, errors) ? &map[std::move(key)] : nullptr;
+}
+
+} // namespace Detail
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a map from the specified value which is checked to contain an object.
+ * \remarks Hashed maps are reserved to hold the members of the object upfront.
+ */
+template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsObject()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    auto obj = value.GetObject();
+    if constexpr (Traits::IsReservable<Type>::value) {
+        reflectable.reserve(reflectable.size() + obj.MemberCount());
+    }
+    for (auto i = obj.MemberBegin(), end = obj.MemberEnd(); i != end; ++i) {
+        if (auto *const mappedValue = Detail::mapValueForKey(reflectable, std::string_view(i->name.GetString(), i->name.GetStringLength()), errors)) {
+            pull(*mappedValue, i->value, errors);
+        }
+    }
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a multimap from the specified value which is checked to contain an object.
+ */
+template <typename Type, Traits::EnableIf<IsMultiMapOrHash<Type>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsObject()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    auto obj = value.GetObject();
+    for (auto i = obj.MemberBegin(), end = obj.MemberEnd(); i != end; ++i) {
+        auto key = typename Type::key_type();
+        if (!Detail::parseMapKey(std::string_view(i->name.GetString(), i->name.GetStringLength()), key, errors)) {
+            continue;
+        }
+        if (i->value.GetType() != RAPIDJSON_NAMESPACE::kArrayType) {
+            auto insertedIterator = reflectable.insert(typename Type::value_type(key, typename Type::mapped_type()));
+            pull(insertedIterator->second, i->value, errors);
+            continue;
+        }
+        const auto array = i->value.GetArray();
+        for (const auto &value : array) {
+            auto insertedIterator = reflectable.insert(typename Type::value_type(key, typename Type::mapped_type()));
+            pull(insertedIterator->second, value, errors);
+        }
+    }
+}
+
+namespace Detail {
+
+/*!
+ * \brief The TuplePullHelper class helps deserializing tuples from JSON arrays.
+ * \remarks Assumes that the array bounds have been checked before (to match the size of the tuple).
+ */
+template <class Tuple, std::size_t N> struct TuplePullHelper {
+    static void pull(Tuple &tuple, const RAPIDJSON_NAMESPACE::Value::ConstArray value, JsonDeserializationErrors *errors)
+    {
+        TuplePullHelper<Tuple, N - 1>::pull(tuple, value, errors);
+        JsonReflector::pull<typename std::tuple_element<N - 1, Tuple>::type>(std::get<N - 1>(tuple), value[N - 1], errors);
+    }
+};
+
+template <class Tuple> struct TuplePullHelper<Tuple, 1> {
+    static void pull(Tuple &tuple, const RAPIDJSON_NAMESPACE::Value::ConstArray value, JsonDeserializationErrors *errors)
+    {
+        JsonReflector::pull<typename std::tuple_element<0, Tuple>::type>(std::get<0>(tuple), value[0], errors);
+    }
+};
+} // namespace Detail
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a tuple from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsArray()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    const auto array = value.GetArray();
+    if (array.Size() != std::tuple_size<Type>::value) {
+        if (errors) {
+            // FIXME: report expected and actual size
+            errors->reportArraySizeMismatch();
+        }
+        return;
+    }
+    Detail::TuplePullHelper<Type, std::tuple_size<Type>::value>::pull(reflectable, array, errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a pair from the specified value which is checked to contain an array.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsArray()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    const auto array = value.GetArray();
+    if (array.Size() != 2) {
+        if (errors) {
+            // FIXME: report expected and actual size
+            errors->reportArraySizeMismatch();
+        }
+        return;
+    }
+    pull(reflectable.first, array[0], errors);
+    pull(reflectable.second, array[1], errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a unique_ptr from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (value.IsNull()) {
+        reflectable.reset();
+        return;
+    }
+    reflectable = std::make_unique<typename Type::element_type>();
+    pull(*reflectable, value, errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a shared_ptr from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (value.IsNull()) {
+        reflectable.reset();
+        return;
+    }
+    reflectable = std::make_shared<typename Type::element_type>();
+    pull(*reflectable, value, errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable which is an optional from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::optional>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (value.IsNull()) {
+        reflectable.reset();
+        return;
+    }
+    pull(reflectable.emplace(), value, errors);
+}
+
+/// \cond
+namespace Detail {
+template <typename Variant, std::size_t compiletimeIndex = 0>
+void assignVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant,
+    const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if constexpr (compiletimeIndex < std::variant_size_v<Variant>) {
+        if (compiletimeIndex == runtimeIndex) {
+            if constexpr (std::is_same_v<std::variant_alternative_t<compiletimeIndex, Variant>, std::monostate>) {
+                variant = std::monostate{};
+            } else {
+                pull(variant.template emplace<compiletimeIndex>(), value, errors);
+            }
+        } else {
+            assignVariantValueByRuntimeIndex<Variant, compiletimeIndex + 1>(runtimeIndex, variant, value, errors);
+        }
+    } else {
+        if (errors) {
+            errors->reportInvalidVariantIndex(JsonType::Number);
+        }
+    }
+}
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief Pulls the specified \a reflectable which is a variant from the specified value which might be null.
+ */
+template <typename Type, Traits::EnableIf<IsVariant<Type>> *>
+void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsObject()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+
+    auto obj = value.GetObject();
+    auto indexIterator = obj.FindMember("index");
+    auto dataIterator = obj.FindMember("data");
+    if (indexIterator == obj.MemberEnd() || dataIterator == obj.MemberEnd()) {
+        if (errors) {
+            errors->reportInvalidVariantObject();
+        }
+        return;
+    }
+    const auto &indexValue = indexIterator->value;
+    if (!indexValue.IsInt()) {
+        if (errors) {
+            errors->reportInvalidVariantIndex(jsonType(indexValue.GetType()));
+        }
+        return;
+    }
+    const auto index = indexValue.GetInt();
+    if (index < 0) {
+        if (errors) {
+            errors->reportInvalidVariantIndex(JsonType::Number);
+        }
+        return;
+    }
+    Detail::assignVariantValueByRuntimeIndex(static_cast<std::size_t>(index), reflectable, dataIterator->value, errors);
+}
+
+/*!
+ * \brief Pulls the specified \a reflectable from the specified value iterator which is checked to contain the right type.
+ */
+template <typename Type>
+inline void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ValueIterator &value, JsonDeserializationErrors *errors)
+{
+    pull<Type>(reflectable, *value, errors);
+    ++value;
+}
+
+/*!
+ * \brief Pulls the specified member of \a reflectable which has a custom type from the specified object.
+ * \remarks It is checked whether the object actually contains the member. If not, the missing member is ignored. So currently all members
+ *          are optional.
+ */
+template <typename Type>
+inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
+    JsonDeserializationErrors *errors)
+{
+    // find member
+    const auto member = value.FindMember(name);
+    if (member == value.MemberEnd()) {
+        return; // TODO: handle member missing
+    }
+
+    // actually pull value for member
+    pull<Type>(reflectable, name, member->value, errors);
+}
+
+/*!
+ * \brief Pulls the specified member of \a reflectable from the specified \a value of that member.
+ * \remarks This is used by the generated code which iterates over the members of an object only once instead of looking
+ *          up each member by its name.
+ */
+template <typename Type>
+inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value,
+    JsonDeserializationErrors *errors)
+{
+    // set error context for current member
+    const char *previousMember;
+    if (errors) {
+        previousMember = errors->currentMember;
+        errors->currentMember = name;
+    }
+
+    // actually pull value for member
+    pull<Type>(reflectable, value, errors);
+
+    // restore previous error context
+    if (errors) {
+        errors->currentMember = previousMember;
+    }
+}
+
+/*!
+ * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ */
+template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
+void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    if (!value.IsObject()) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(value.GetType());
+        }
+        return;
+    }
+    pull(reflectable, value.GetObject(), errors);
+}
+
+// define functions to "read" values directly from a JsonReader (without building a document first)
+
+/*!
+ * \brief The JsonFieldMask class specifies the members to be deserialized when projecting (see fromJson() overload taking a mask).
+ * \remarks Members are identified by their JSON names which are the names of the C++ members. Only the members of the top-level
+ *          object are considered; nested objects are deserialized completely if their member is contained.
+ */
+class JsonFieldMask {
+public:
+    JsonFieldMask(std::initializer_list<std::string_view> memberNames);
+    template <typename Iterator> JsonFieldMask(Iterator begin, Iterator end);
+
+    bool contains(std::string_view memberName) const;
+
+private:
+    std::vector<std::string> m_memberNames;
+};
+
+/*!
+ * \brief Constructs a mask containing the specified \a memberNames.
+ */
+inline JsonFieldMask::JsonFieldMask(std::initializer_list<std::string_view> memberNames)
+    : JsonFieldMask(memberNames.begin(), memberNames.end())
+{
+}
+
+/*!
+ * \brief Constructs a mask containing the member names in the range from \a begin to \a end.
+ */
+template <typename Iterator> JsonFieldMask::JsonFieldMask(Iterator begin, Iterator end)
+{
+    for (; begin != end; ++begin) {
+        m_memberNames.emplace_back(*begin);
+    }
+}
+
+/*!
+ * \brief Returns whether the member with the specified \a memberName is contained.
+ * \remarks Does a linear search which is the most efficient approach as masks are supposed to contain only a few members.
+ */
+inline bool JsonFieldMask::contains(std::string_view memberName) const
+{
+    return std::find(m_memberNames.cbegin(), m_memberNames.cend(), memberName) != m_memberNames.cend();
+}
+
+/*!
+ * \brief Reads the \a reflectable which has a custom type from the specified reader which is supposed and checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is an array/vector/list from the specified reader which is checked to be positioned at an array.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<IsSet<Type>>, Traits::Not<IsMultiSet<Type>>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a set from the specified reader which is checked to be positioned at an array.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsSet<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a multiset from the specified reader which is checked to be positioned at an array.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMultiSet<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a map from the specified reader which is checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a multimap from the specified reader which is checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMultiMapOrHash<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a tuple or pair from the specified reader which is checked to be positioned at an array.
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a unique_ptr, shared_ptr or optional from the specified reader which might be
+ *        positioned at null.
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+        Traits::IsSpecializationOf<Type, std::optional>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the specified \a reflectable which is a variant from the specified reader which is checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsVariant<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the value of the member with the specified \a name into \a reflectable.
+ * \remarks The reader is supposed to be positioned at the member's key.
+ */
+template <typename Type, typename Reader> void read(Type &reflectable, const char *name, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Reads the integer or float from the specified reader which is supposed and checked to be positioned at a number.
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIf<Traits::Not<std::is_same<Type, bool>>, Traits::Any<std::is_integral<Type>, std::is_floating_point<Type>>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::Number) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    reflectable = reader.template numberValue<Type>();
+}
+
+/*!
+ * \brief Reads the boolean from the specified reader which is supposed and checked to be positioned at a boolean.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<std::is_same<Type, bool>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::Bool) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    reflectable = reader.boolValue();
+}
+
+/*!
+ * \brief Reads the specified enumeration item from the specified reader which is supposed and checked to be compatible with the underlying type.
+ * \remarks It is *not* checked, whether the value is actually a valid enum item.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<std::is_enum<Type>, Traits::Not<JsonEnumByName<Type>>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    using ExpectedType = Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>;
+    if (std::is_unsigned_v<ExpectedType> ? !reader.isUint64() : !reader.isInt64()) {
+        if (errors) {
+            errors->reportTypeMismatch<ExpectedType>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    reflectable = static_cast<Type>(reader.template numberValue<ExpectedType>());
+}
+
+/*!
+ * \brief Reads the specified enumeration item from the specified reader which is supposed and checked to be positioned at the name
+ *        of an enumerator.
+ * \remarks Unknown names are reported as conversion error. Numbers are accepted as well (see pull()).
+ */
+template <typename Type, typename Reader, Traits::EnableIf<std::is_enum<Type>, JsonEnumByName<Type>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() == JsonToken::Number) {
+        using ExpectedType = Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>;
+        if (std::is_unsigned_v<ExpectedType> ? !reader.isUint64() : !reader.isInt64()) {
+            if (errors) {
+                errors->reportTypeMismatch<ExpectedType>(reader.type());
+            }
+            return;
+        }
+        reflectable = static_cast<Type>(reader.template numberValue<ExpectedType>());
+        return;
+    }
+    if (reader.token() != JsonToken::String) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    if (const auto *const enumValue = enumValueByName<Type>(reader.stringValue())) {
+        reflectable = *enumValue;
+    } else if (errors) {
+        errors->reportConversionError(JsonType::String);
+    }
+}
+
+/*!
+ * \brief Reads the std::string from the specified reader which is supposed and checked to be positioned at a string.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::String) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    reader.takeStringValue(reflectable);
+}
+
+/*!
+ * \brief Checks whether the specified reader is positioned at a string.
+ * \remarks When parsing in-situ, the value is stored as it points into the caller-owned buffer then (see fromJsonInsitu()).
+ *          Otherwise the value is not stored since the ownership would not be clear (see README.md).
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>, std::is_same<Type, std::string_view>> * = nullptr>
+inline void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::String) {
+        if (errors) {
+            errors->reportTypeMismatch<std::string>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    if (!reader.isInsitu()) {
+        return;
+    }
+    if constexpr (std::is_same_v<Type, std::string_view>) {
+        reflectable = reader.stringValue();
+    } else if constexpr (std::is_same_v<Type, const char *>) {
+        reflectable = reader.stringValue().data();
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is an array/vector/list from the specified reader which is checked to be positioned at an array.
+ * \remarks The \a reflectable is cleared before.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<IsSet<Type>>, Traits::Not<IsMultiSet<Type>>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartArray) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+
+    // clear previous contents of the array
+    reflectable.clear();
+
+    // read all array elements
+    std::size_t index = 0;
+    while (reader.next() != JsonToken::EndArray) {
+        // set error context for current index
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentIndex = index;
+            }
+        }
+        ++index;
+        reflectable.emplace_back();
+        read(reflectable.back(), reader, errors);
+    }
+
+    // clear error context
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            errors->currentIndex = JsonDeserializationError::noIndex;
+        }
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a set from the specified reader which is checked to be positioned at an array.
+ * \remarks The \a reflectable is cleared before.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsSet<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartArray) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+
+    // clear previous contents of the set
+    reflectable.clear();
+
+    // read all array elements
+    std::size_t index = 0;
+    while (reader.next() != JsonToken::EndArray) {
+        // set error context for current index
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentIndex = index;
+            }
+        }
+        ++index;
+        typename Type::value_type itemObj;
+        read(itemObj, reader, errors);
+        if (!reflectable.emplace(std::move(itemObj)).second && errors) {
+            errors->reportUnexpectedDuplicate(JsonType::Array);
+        }
+    }
+
+    // clear error context
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            errors->currentIndex = JsonDeserializationError::noIndex;
+        }
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a multiset from the specified reader which is checked to be positioned at an array.
+ * \remarks The \a reflectable is cleared before.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMultiSet<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartArray) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+
+    // clear previous contents of the multiset
+    reflectable.clear();
+
+    // read all array elements
+    std::size_t index = 0;
+    while (reader.next() != JsonToken::EndArray) {
+        // set error context for current index
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentIndex = index;
+            }
+        }
+        ++index;
+        typename Type::value_type itemObj;
+        read(itemObj, reader, errors);
+        reflectable.emplace(std::move(itemObj));
+    }
+
+    // clear error context
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            errors->currentIndex = JsonDeserializationError::noIndex;
+        }
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a map from the specified reader which is checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMapOrHash<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartObject) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    while (reader.next() == JsonToken::Key) {
+        auto *const value = Detail::mapValueForKey(reflectable, reader.key(), errors);
+        reader.next();
+        if (value) {
+            read(*value, reader, errors);
+        } else {
+            reader.skip();
+        }
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a multimap from the specified reader which is checked to be positioned at an object.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMultiMapOrHash<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartObject) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    while (reader.next() == JsonToken::Key) {
+        auto key = typename Type::key_type();
+        if (!Detail::parseMapKey(reader.key(), key, errors)) {
+            reader.next();
+            reader.skip();
+            continue;
+        }
+        if (reader.next() != JsonToken::StartArray) {
+            auto insertedIterator = reflectable.insert(typename Type::value_type(key, typename Type::mapped_type()));
+            read(insertedIterator->second, reader, errors);
+            continue;
+        }
+        while (reader.next() != JsonToken::EndArray) {
+            auto insertedIterator = reflectable.insert(typename Type::value_type(key, typename Type::mapped_type()));
+            read(insertedIterator->second, reader, errors);
+        }
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a tuple or pair from the specified reader which is checked to be positioned at an array.
+ * \remarks Unlike pull(), elements are assigned as they arrive. So in case of an ArraySizeMismatch, the leading elements
+ *          might already be assigned.
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::tuple>, Traits::IsSpecializationOf<Type, std::pair>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartArray) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    auto sizeMatches = true;
+    std::apply(
+        [&reader, &errors, &sizeMatches](auto &... elements) {
+            ((sizeMatches = sizeMatches && reader.next() != JsonToken::EndArray, sizeMatches ? read(elements, reader, errors) : void()), ...);
+        },
+        reflectable);
+    if (sizeMatches && reader.next() != JsonToken::EndArray) {
+        sizeMatches = false;
+        do {
+            reader.skip();
+        } while (reader.next() != JsonToken::EndArray);
+    }
+    if (!sizeMatches && errors) {
+        // FIXME: report expected and actual size
+        errors->reportArraySizeMismatch();
+    }
+}
+
+/*!
+ * \brief Reads the specified \a reflectable which is a unique_ptr, shared_ptr or optional from the specified reader which might be
+ *        positioned at null.
+ */
+template <typename Type, typename Reader,
+    Traits::EnableIfAny<Traits::IsSpecializationOf<Type, std::unique_ptr>, Traits::IsSpecializationOf<Type, std::shared_ptr>,
+        Traits::IsSpecializationOf<Type, std::optional>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() == JsonToken::Null) {
+        reflectable.reset();
+        return;
+    }
+    if constexpr (Traits::IsSpecializationOf<Type, std::unique_ptr>::value) {
+        reflectable = std::make_unique<typename Type::element_type>();
+    } else if constexpr (Traits::IsSpecializationOf<Type, std::shared_ptr>::value) {
+        reflectable = std::make_shared<typename Type::element_type>();
+    } else {
+        reflectable.emplace();
+    }
+    read(*reflectable, reader, errors);
+}
+
+/// \cond
+namespace Detail {
+template <typename Variant, typename Reader, std::size_t compiletimeIndex = 0>
+void readVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if constexpr (compiletimeIndex < std::variant_size_v<Variant>) {
+        if (compiletimeIndex == runtimeIndex) {
+            if constexpr (std::is_same_v<std::variant_alternative_t<compiletimeIndex, Variant>, std::monostate>) {
+                variant = std::monostate{};
+                reader.skip();
+            } else {
+                read(variant.template emplace<compiletimeIndex>(), reader, errors);
+            }
+        } else {
+            readVariantValueByRuntimeIndex<Variant, Reader, compiletimeIndex + 1>(runtimeIndex, variant, reader, errors);
+        }
+    } else {
+        if (errors) {
+            errors->reportInvalidVariantIndex(JsonType::Number);
+        }
+        reader.skip();
+    }
+}
+
+template <typename Type> constexpr bool containsStringViews();
+
+/*!
+ * \brief Returns whether one of the template arguments of the specified variant, tuple or pair contains non-owning strings.
+ */
+template <template <typename...> class Template, typename... Types> constexpr bool anyContainsStringViews(const Template<Types...> *)
+{
+    return (containsStringViews<Types>() || ...);
+}
+
+/*!
+ * \brief Returns whether \tparam Type contains non-owning strings (std::string_view or const char *) which can only be read in-situ.
+ * \remarks Custom types are not inspected and assumed to contain only owning strings.
+ */
+template <typename Type> constexpr bool containsStringViews()
+{
+    if constexpr (std::is_same_v<Type, std::string_view> || std::is_same_v<Type, const char *>) {
+        return true;
+    } else if constexpr (IsVariant<Type>::value || Traits::IsSpecializationOf<Type, std::tuple>::value
+        || Traits::IsSpecializationOf<Type, std::pair>::value) {
+        return anyContainsStringViews(static_cast<const Type *>(nullptr));
+    } else if constexpr (Traits::IsSpecializationOf<Type, std::unique_ptr>::value || Traits::IsSpecializationOf<Type, std::shared_ptr>::value) {
+        return containsStringViews<typename Type::element_type>();
+    } else if constexpr (Traits::IsSpecializationOf<Type, std::optional>::value) {
+        return containsStringViews<typename Type::value_type>();
+    } else if constexpr (IsMapOrHash<Type>::value || IsMultiMapOrHash<Type>::value) {
+        return containsStringViews<typename Type::mapped_type>();
+    } else if constexpr (IsArrayOrSet<Type>::value) {
+        return containsStringViews<typename Type::value_type>();
+    } else {
+        return false;
+    }
+}
+
+/*!
+ * \brief Returns whether the alternative of \tparam Variant with the specified \a runtimeIndex contains non-owning strings.
+ */
+template <typename Variant, std::size_t compiletimeIndex = 0> constexpr bool variantAlternativeContainsStringViews(std::size_t runtimeIndex)
+{
+    if constexpr (compiletimeIndex < std::variant_size_v<Variant>) {
+        return compiletimeIndex == runtimeIndex ? containsStringViews<std::variant_alternative_t<compiletimeIndex, Variant>>()
+                                                : variantAlternativeContainsStringViews<Variant, compiletimeIndex + 1>(runtimeIndex);
+    } else {
+        return false;
+    }
+}
+
+/*!
+ * \brief Copies the value the \a reader is positioned at to the specified \a writer.
+ * \remarks This is used to buffer the data of a variant if it precedes the index.
+ */
+template <typename Reader, typename Writer> void copyValue(Reader &reader, Writer &writer)
+{
+    for (std::size_t depth = 0;;) {
+        switch (reader.token()) {
+        case JsonToken::Null:
+            writer.Null();
+            break;
+        case JsonToken::Bool:
+            writer.Bool(reader.boolValue());
+            break;
+        case JsonToken::Number:
+            if (reader.isInt64()) {
+                writer.Int64(reader.template numberValue<std::int64_t>());
+            } else if (reader.isUint64()) {
+                writer.Uint64(reader.template numberValue<std::uint64_t>());
+            } else {
+                writer.Double(reader.template numberValue<double>());
+            }
+            break;
+        case JsonToken::String:
+            writer.String(reader.stringValue().data(), rapidJsonSize(reader.stringValue().size()));
+            break;
+        case JsonToken::Key:
+            writer.Key(reader.key().data(), rapidJsonSize(reader.key().size()));
+            break;
+        case JsonToken::StartObject:
+            writer.StartObject();
+            ++depth;
+            break;
+        case JsonToken::StartArray:
+            writer.StartArray();
+            ++depth;
+            break;
+        case JsonToken::EndObject:
+            writer.EndObject();
+            --depth;
+            break;
+        case JsonToken::EndArray:
+            writer.EndArray();
+            --depth;
+            break;
+        default:;
+        }
+        if (!depth) {
+            return;
+        }
+        reader.next();
+    }
+}
+
+/*!
+ * \brief Pulls the \a reflectable which has a custom type without JsonMembers specialization from the value the \a reader is
+ *        positioned at.
+ * \remarks The value is copied into an intermediate document first so types which only specialize pull() can be read as well.
+ */
+template <typename Type, typename Reader> void pullFromReader(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    RAPIDJSON_NAMESPACE::StringBuffer bufferedData;
+    {
+        JsonStringBufferOutputStream stream(bufferedData);
+        // allow NaN and infinity as the reader might have accepted them (via kParseNanAndInfFlag)
+        BasicJsonWriter<RAPIDJSON_NAMESPACE::kWriteNanAndInfFlag> writer(stream);
+        copyValue(reader, writer);
+    }
+    RAPIDJSON_NAMESPACE::Document document;
+    document.Parse<RAPIDJSON_NAMESPACE::kParseNanAndInfFlag | RAPIDJSON_NAMESPACE::kParseFullPrecisionFlag>(
+        bufferedData.GetString(), bufferedData.GetSize());
+    pull(reflectable, static_cast<const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &>(document), errors);
+}
+
+} // namespace Detail
+/// \endcond
+
+/*!
+ * \brief Reads the specified \a reflectable which is a variant from the specified reader which is checked to be positioned at an object.
+ * \remarks The "data" member is read directly if the "index" member precedes it (which is the case for JSON written by
+ *          this library). Otherwise it is buffered until the index is known. When parsing in-situ, std::string_view and
+ *          const char * can not point into that buffer so a conversion error is reported if the alternative selected by the
+ *          index contains those (see Detail::containsStringViews()).
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsVariant<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() != JsonToken::StartObject) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+
+    auto index = std::numeric_limits<std::size_t>::max();
+    auto hasIndex = false, hasData = false, validIndex = true;
+    auto bufferedDataType = RAPIDJSON_NAMESPACE::kNullType;
+    RAPIDJSON_NAMESPACE::StringBuffer bufferedData;
+    while (reader.next() == JsonToken::Key) {
+        const auto key = reader.key();
+        if (key == "index") {
+            hasIndex = true;
+            reader.next();
+            if (!reader.isInt64() || reader.template numberValue<std::int64_t>() < 0
+                || reader.template numberValue<std::int64_t>() > std::numeric_limits<int>::max()) {
+                if (errors) {
+                    errors->reportInvalidVariantIndex(jsonType(reader.type()));
+                }
+                validIndex = false;
+                reader.skip();
+                continue;
+            }
+            index = static_cast<std::size_t>(reader.template numberValue<std::int64_t>());
+        } else if (key == "data") {
+            hasData = true;
+            reader.next();
+            if (!hasIndex) {
+                bufferedDataType = reader.type();
+                JsonStringBufferOutputStream stream(bufferedData);
+                // allow NaN and infinity as the reader might have accepted them (via kParseNanAndInfFlag)
+                BasicJsonWriter<RAPIDJSON_NAMESPACE::kWriteNanAndInfFlag> writer(stream);
+                Detail::copyValue(reader, writer);
+            } else if (validIndex) {
+                Detail::readVariantValueByRuntimeIndex(index, reflectable, reader, errors);
+            } else {
+                reader.skip();
+            }
+        } else {
+            reader.next();
+            reader.skip();
+        }
+    }
+    if (!hasIndex || !hasData) {
+        if (errors) {
+            errors->reportInvalidVariantObject();
+        }
+        return;
+    }
+    if (validIndex && bufferedData.GetSize()) {
+        if (reader.isInsitu() && Detail::variantAlternativeContainsStringViews<Type>(index)) {
+            if (errors) {
+                errors->reportConversionError(jsonType(bufferedDataType));
+            }
+            return;
+        }
+        Reader dataReader(bufferedData.GetString(), bufferedData.GetSize());
+        dataReader.next();
+        Detail::readVariantValueByRuntimeIndex(index, reflectable, dataReader, errors);
+    }
+}
+
+/*!
+ * \brief Reads the value of the member with the specified \a name into \a reflectable.
+ * \remarks The reader is supposed to be positioned at the member's key.
+ */
+template <typename Type, typename Reader> void read(Type &reflectable, const char *name, Reader &reader, JsonDeserializationErrors *errors)
+{
+    // set error context for current member
+    const char *previousMember;
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            previousMember = errors->currentMember;
+            errors->currentMember = name;
+        }
+    }
+
+    // actually read value for member
+    reader.next();
+    read(reflectable, reader, errors);
+
+    // restore previous error context
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            errors->currentMember = previousMember;
+        }
+    }
+}
+
+/*!
+ * \brief Reads the \a reflectable which has a custom type from the specified reader which is supposed and checked to be positioned at an object.
+ * \remarks Members not known by JsonMembers::readMember() are skipped. So like with pull(), all members are optional.
+ * \remarks Types without JsonMembers specialization (see HasJsonMembers) are pulled from an intermediate value instead.
+ */
+template <typename Type, typename Reader, Traits::DisableIf<IsBuiltInType<Type>> *>
+void read(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if constexpr (!HasJsonMembers<Type>::value) {
+        Detail::pullFromReader(reflectable, reader, errors);
+    } else {
+        if (reader.token() != JsonToken::StartObject) {
+            if (errors) {
+                errors->reportTypeMismatch<Type>(reader.type());
+            }
+            reader.skip();
+            return;
+        }
+        while (reader.next() == JsonToken::Key) {
+            if (!JsonMembers<Type>::readMember(reflectable, reader.key(), reader, errors)) {
+                reader.next();
+                reader.skip();
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Reads the members of the \a reflectable which has a custom type contained by the specified \a mask from the specified reader
+ *        which is supposed and checked to be positioned at an object.
+ * \remarks Members not contained by the \a mask are skipped without being converted. Their values are only tokenized.
+ * \remarks Types without JsonMembers specialization (see HasJsonMembers) are read completely regardless of the \a mask.
+ */
+template <typename Type, typename Reader, Traits::DisableIf<IsBuiltInType<Type>> * = nullptr>
+void read(Type &reflectable, Reader &reader, const JsonFieldMask &mask, JsonDeserializationErrors *errors)
+{
+    if constexpr (!HasJsonMembers<Type>::value) {
+        read(reflectable, reader, errors);
+    } else {
+        if (reader.token() != JsonToken::StartObject) {
+            if (errors) {
+                errors->reportTypeMismatch<Type>(reader.type());
+            }
+            reader.skip();
+            return;
+        }
+        while (reader.next() == JsonToken::Key) {
+            if (!mask.contains(reader.key()) || !JsonMembers<Type>::readMember(reflectable, reader.key(), reader, errors)) {
+                reader.next();
+                reader.skip();
+            }
+        }
+    }
+}
+
+// define functions to apply JSON merge patches (RFC 7386) read from a JsonReader to existing objects
+
+/*!
+ * \brief Applies the merge patch the specified reader is positioned at to the \a reflectable which has a custom type.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+void mergePatch(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Applies the merge patch the specified reader is positioned at to the \a reflectable which is a map.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMapOrHash<Type>> * = nullptr>
+void mergePatch(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors);
+
+/*!
+ * \brief Applies the merge patch the specified reader is positioned at to the \a reflectable which is neither a map nor a custom type.
+ * \remarks The \a reflectable is reset to its default value if the patch is null and replaced by the patch otherwise. So arrays
+ *          and multimaps are always replaced as a whole as defined by RFC 7386. This also applies to custom types with custom (de)serialization.
+ */
+template <typename Type, typename Reader, Traits::DisableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>> * = nullptr>
+void mergePatch(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() == JsonToken::Null) {
+        reflectable = Type();
+        return;
+    }
+    if constexpr (IsMultiMapOrHash<Type>::value) {
+        // clear multimaps explicitly as read() inserts into them without clearing them first
+        if (reader.token() == JsonToken::StartObject) {
+            reflectable.clear();
+        }
+    }
+    read(reflectable, reader, errors);
+}
+
+/*!
+ * \brief Applies the merge patch for the member with the specified \a name to \a reflectable.
+ * \remarks The reader is supposed to be positioned at the member's key.
+ */
+template <typename Type, typename Reader> void mergePatch(Type &reflectable, const char *name, Reader &reader, JsonDeserializationErrors *errors)
+{
+    // set error context for current member
+    const char *previousMember;
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            previousMember = errors->currentMember;
+            errors->currentMember = name;
+        }
+    }
+
+    // actually apply patch for member
+    reader.next();
+    mergePatch(reflectable, reader, errors);
+
+    // restore previous error context
+    if constexpr (Reader::tracksErrorContext) {
+        if (errors) {
+            errors->currentMember = previousMember;
+        }
+    }
+}
+
+/*!
+ * \brief Applies the merge patch the specified reader is positioned at to the \a reflectable which has a custom type.
+ * \remarks Only members present in the patch are touched; a null value resets the member to its default value and an object
+ *          is applied recursively to members which have a custom type or are maps. If the patch is null, the whole
+ *          \a reflectable is reset. Unknown members are ignored.
+ * \remarks Types without JsonMembers specialization (see HasJsonMembers) are replaced as a whole.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsJsonSerializable<Type>> *>
+void mergePatch(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() == JsonToken::Null) {
+        reflectable = Type();
+        return;
+    }
+    if constexpr (!HasJsonMembers<Type>::value) {
+        read(reflectable, reader, errors);
+    } else {
+        if (reader.token() != JsonToken::StartObject) {
+            if (errors) {
+                errors->reportTypeMismatch<Type>(reader.type());
+            }
+            reader.skip();
+            return;
+        }
+        while (reader.next() == JsonToken::Key) {
+            if (!JsonMembers<Type>::mergePatchMember(reflectable, reader.key(), reader, errors)) {
+                reader.next();
+                reader.skip();
+            }
+        }
+    }
+}
+
+/*!
+ * \brief Applies the merge patch the specified reader is positioned at to the \a reflectable which is a map.
+ * \remarks Only keys present in the patch are touched; a null value removes the key and other values are applied recursively to
+ *          existing values or inserted. If the patch is null, the whole map is cleared.
+ */
+template <typename Type, typename Reader, Traits::EnableIf<IsMapOrHash<Type>> *>
+void mergePatch(Type &reflectable, Reader &reader, JsonDeserializationErrors *errors)
+{
+    if (reader.token() == JsonToken::Null) {
+        reflectable.clear();
+        return;
+    }
+    if (reader.token() != JsonToken::StartObject) {
+        if (errors) {
+            errors->reportTypeMismatch<Type>(reader.type());
+        }
+        reader.skip();
+        return;
+    }
+    while (reader.next() == JsonToken::Key) {
+        auto key = typename Type::key_type();
+        if (!Detail::parseMapKey(reader.key(), key, errors)) {
+            reader.next();
+            reader.skip();
+            continue;
+        }
+        if (reader.next() == JsonToken::Null) {
+            reflectable.erase(key);
+            continue;
+        }
+        mergePatch(reflectable[std::move(key)], reader, errors);
+    }
+}
+
+// define functions providing high-level JSON serialization
+
+/*!
+ * \brief Serializes the specified \a reflectable which has a custom type or can be mapped to and object.
+ */
+template <typename Type, Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDocument(const Type &reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kObjectType);
+    push(reflectable, document, document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which is an integer, float or boolean.
+ */
+template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDocument(Type reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kNumberType);
+    document.Set(reflectable, document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which is an std::string.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDocument(const std::string &reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
+    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable.data(), reflectable.size()), document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which is a C-string.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, const char *>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDocument(const char *reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
+    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable), document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which is a C-string.
+ */
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string_view>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDocument(std::string_view reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
+    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable.data(), reflectable.size()), document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which can be mapped to an array.
+ */
+template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr> RAPIDJSON_NAMESPACE::Document toJsonDocument(const Type &reflectable)
+{
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kArrayType);
+    push(reflectable, document, document.GetAllocator());
+    return document;
+}
+
+/*!
+ * \brief Serializes the specified \a reflectable which has a custom type or can be mapped to an object or array reusing the
+ *        memory of the specified \a context.
+ * \remarks The returned document is owned by the \a context and only valid until the \a context is used again.
+ */
+template <typename Type, Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, IsArray<Type>> * = nullptr>
+Context::Document &toJsonDocument(Context &context, const Type &reflectable)
+{
+    context.clear();
+    auto &document = context.document();
+    if constexpr (IsArray<Type>::value) {
+        document.SetArray();
+    } else {
+        document.SetObject();
+    }
+    push(reflectable, document, document.GetAllocator());
+    return document;
+}
+
+namespace Detail {
+
+/*!
+ * \brief Writes the specified \a reflectable to the specified \a stream using the flags of the specified \tparam Policy.
+ */
+template <typename Policy, typename Type> void writeJson(const Type &reflectable, JsonOutputStream &stream)
+{
+    BasicJsonWriter<Policy::writeFlags> writer(stream);
+    writer.SetMaxDecimalPlaces(Policy::maxDecimalPlaces);
+    write(reflectable, writer);
+}
+
+} // namespace Detail
 
 /*!
- * \brief Pulls the integer or float from the specified value which is supposed and checked to contain the right type.
+ * \brief Serializes the specified \a reflectable appending the JSON to the specified \a out buffer.
+ * \remarks The JSON is written directly into the buffer so it can be reused across calls.
  */
-template <typename Type,
-    Traits::EnableIf<Traits::Not<std::is_same<Type, bool>>, Traits::Any<std::is_integral<Type>, std::is_floating_point<Type>>> * = nullptr>
-inline void pull(
-    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy,
+    Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, std::is_integral<Type>, std::is_floating_point<Type>,
+        Traits::IsString<Type>, IsArray<Type>> * = nullptr>
+void toJson(const Type &reflectable, RAPIDJSON_NAMESPACE::StringBuffer &out)
 {
-    if (!value.IsNumber()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
-    }
-    reflectable = value.Is<Type>() ? value.Get<Type>() : static_cast<Type>(value.GetDouble());
+    JsonStringBufferOutputStream stream(out);
+    Detail::writeJson<Policy>(reflectable, stream);
 }
 
 /*!
- * \brief Pulls the boolean from the specified value which is supposed and checked to contain the right type.
+ * \brief Serializes the specified \a reflectable.
+ * \remarks The JSON is written directly into the returned buffer using the write() functions so no intermediate
+ *          JSON document is built.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, bool>> * = nullptr>
-inline void pull(
-    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy,
+    Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, std::is_integral<Type>, std::is_floating_point<Type>,
+        Traits::IsString<Type>, IsArray<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::StringBuffer toJson(const Type &reflectable)
 {
-    if (!value.IsBool()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
-    }
-    reflectable = value.GetBool();
+    RAPIDJSON_NAMESPACE::StringBuffer buffer;
+    toJson<Type, Policy>(reflectable, buffer);
+    return buffer;
 }
 
 /*!
- * \brief Pulls the specified enumeration item from the specified value which is supposed and checked to be compatible with the underlying type.
- * \remarks It is *not* checked, whether \a value is actually a valid enum item.
+ * \brief Serializes the specified \a reflectable appending the JSON to the specified \a out string.
+ * \remarks The JSON is written directly into the string's storage so no copy is made and its capacity can be reused
+ *          across calls.
  */
-template <typename Type, Traits::EnableIfAny<std::is_enum<Type>> * = nullptr>
-inline void pull(
-    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy,
+    Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, std::is_integral<Type>, std::is_floating_point<Type>,
+        Traits::IsString<Type>, IsArray<Type>> * = nullptr>
+void toJson(const Type &reflectable, std::string &out)
 {
-    using ExpectedType = Traits::Conditional<std::is_unsigned<typename std::underlying_type<Type>::type>, std::uint64_t, std::int64_t>;
-    if (!value.Is<ExpectedType>()) {
-        if (errors) {
-            errors->reportTypeMismatch<ExpectedType>(value.GetType());
-        }
-        return;
-    }
-    reflectable = static_cast<Type>(value.Get<ExpectedType>());
+    JsonStringOutputStream stream(out);
+    Detail::writeJson<Policy>(reflectable, stream);
 }
 
 /*!
- * \brief Pulls the std::string from the specified value which is supposed and checked to contain a string.
+ * \brief Serializes the specified \a reflectable writing the JSON to the specified \a out stream.
+ * \remarks \tparam OutputStream might be an std::ostream or a RapidJSON output stream. The JSON is forwarded in chunks.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
-inline void pull(
-    Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy, typename OutputStream,
+    Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, std::is_integral<Type>, std::is_floating_point<Type>,
+        Traits::IsString<Type>, IsArray<Type>> * = nullptr,
+    Traits::DisableIfAny<std::is_same<OutputStream, std::string>, std::is_same<OutputStream, RAPIDJSON_NAMESPACE::StringBuffer>> * = nullptr>
+void toJson(const Type &reflectable, OutputStream &out)
 {
-    if (!value.IsString()) {
-        if (errors) {
-            errors->reportTypeMismatch<std::string>(value.GetType());
-        }
-        return;
-    }
-    reflectable = value.GetString();
+    JsonGenericOutputStream<OutputStream> stream(out);
+    Detail::writeJson<Policy>(reflectable, stream);
 }
 
 /*!
- * \brief Checks whether the specified value contains a string.
- * \remarks Does not actually store the value since the ownership would not be clear (see README.md).
+ * \brief Serializes only the members of the specified \a reflectable which differ from the specified \a baseline.
+ * \remarks The resulting document is a JSON merge patch (RFC 7386) turning \a baseline into \a reflectable when applied via
+ *          applyMergePatch(). Nested objects and maps are compared recursively (removed map keys are denoted by null) and other
+ *          members are emitted as a whole if they differ.
+ * \remarks Strings are not copied so \a reflectable and \a baseline must outlive the returned document.
  */
-template <typename Type,
-    Traits::EnableIfAny<std::is_same<Type, const char *>, std::is_same<Type, const char *const &>, std::is_same<Type, std::string_view>> * = nullptr>
-inline void pull(Type &, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::Document toJsonDeltaDocument(const Type &reflectable, const Type &baseline)
 {
-    if (!value.IsString()) {
-        if (errors) {
-            errors->reportTypeMismatch<std::string>(value.GetType());
-        }
-        return;
-    }
+    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kObjectType);
+    RAPIDJSON_NAMESPACE::Value::Object object(document.GetObject());
+    pushDelta(reflectable, baseline, object, document.GetAllocator());
+    return document;
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is an iteratable without reserve() method from the specified value which is checked to contain an array.
+ * \brief Serializes only the members of the specified \a reflectable which differ from the specified \a baseline.
+ * \remarks See toJsonDeltaDocument() for details. If nothing differs, the result is "{}".
  */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::Not<Traits::IsReservable<Type>>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::StringBuffer toJsonDelta(const Type &reflectable, const Type &baseline)
 {
-    if (!value.IsArray()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
-    }
-    pull(reflectable, value.GetArray(), errors);
+    auto document = toJsonDeltaDocument(reflectable, baseline);
+    return serializeJsonDocToString<Policy>(document);
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is an iteratable with reserve() method from the specified value which is checked to contain an array.
+ * \brief Serializes the specified \a reflectable omitting members which are equal to their default value.
+ * \remarks Members are compared to the ones of a default-constructed \a Type and written directly via writeWithoutDefault() so
+ *          no intermediate JSON document is built. Nested objects are handled recursively; other members (including maps) are
+ *          written as a whole if they differ and null is never written. Since missing members are left untouched when
+ *          deserializing, fromJson() restores the original object from the result.
+ * \remarks Use toJsonDelta() to serialize only the differences of maps as well.
  */
-template <typename Type, Traits::EnableIf<IsArrayOrSet<Type>, Traits::IsReservable<Type>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+RAPIDJSON_NAMESPACE::StringBuffer toJsonWithoutDefaults(const Type &reflectable)
 {
-    if (!value.IsArray()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
+    RAPIDJSON_NAMESPACE::StringBuffer buffer;
+    JsonStringBufferOutputStream stream(buffer);
+    BasicJsonWriter<Policy::writeFlags> writer(stream);
+    writer.SetMaxDecimalPlaces(Policy::maxDecimalPlaces);
+    if constexpr (HasJsonMembers<Type>::value) {
+        static const auto defaults = Type();
+        writer.StartObject();
+        JsonMembers<Type>::writeMembersWithoutDefaults(reflectable, defaults, writer);
+        writer.EndObject();
+    } else {
+        write(reflectable, writer);
     }
-    auto array = value.GetArray();
-    reflectable.reserve(array.Size());
-    pull(reflectable, array, errors);
+    return buffer;
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is an array/vector/list from the specified array. The \a reflectable is cleared before.
+ * \brief Serializes the elements of the specified \a container as newline-delimited JSON appending it to the specified \a out string.
+ * \remarks The elements are split into consecutive chunks which are serialized in parallel by \a threadCount threads (or
+ *          std::thread::hardware_concurrency() threads if 0) using the write() functions. Each thread writes into its
+ *          own buffer and the buffers are appended to \a out in order. So the order of the lines is the order of the elements.
+ * \remarks Each line, including the last one, is terminated by a newline character.
+ * \remarks The write flags and the maximum number of decimal places of the specified \tparam Policy are used (see JsonPolicy).
  */
-template <typename Type, Traits::EnableIf<IsArray<Type>> *>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+template <typename Container, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsArray<Container>> * = nullptr>
+void toJsonLines(const Container &container, std::string &out, std::size_t threadCount = 0)
 {
-    // clear previous contents of the array
-    reflectable.clear();
-
-    // pull all array elements of the specified value
-    std::size_t index = 0;
-    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
-        // set error context for current index
-        if (errors) {
-            errors->currentIndex = index;
+    using Iterator = decltype(std::begin(container));
+    const auto writeLines = [](Iterator begin, Iterator end, std::string &buffer) {
+        JsonStringOutputStream stream(buffer);
+        BasicJsonWriter<Policy::writeFlags> writer(stream);
+        writer.SetMaxDecimalPlaces(Policy::maxDecimalPlaces);
+        for (; begin != end; ++begin) {
+            write(*begin, writer);
+            stream.Put('\n');
+            writer.Reset(stream);
         }
-        ++index;
-        reflectable.emplace_back();
-        pull(reflectable.back(), item, errors);
+    };
+
+    // determine chunks
+    const auto size = static_cast<std::size_t>(std::distance(std::begin(container), std::end(container)));
+    if (!threadCount) {
+        threadCount = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+    threadCount = std::min(threadCount, size);
+    if (threadCount <= 1) {
+        writeLines(std::begin(container), std::end(container), out);
+        return;
     }
+    const auto chunkSize = size / threadCount, remainder = size % threadCount;
 
-    // clear error context
-    if (errors) {
-        errors->currentIndex = JsonDeserializationError::noIndex;
+    // serialize chunks in parallel; serialize the first chunk in the calling thread and directly into out
+    auto buffers = std::vector<std::string>(threadCount - 1);
+    auto futures = std::vector<std::future<void>>();
+    futures.reserve(threadCount - 1);
+    auto chunkBegin = std::next(std::begin(container), static_cast<std::ptrdiff_t>(chunkSize + (remainder ? 1 : 0)));
+    const auto firstChunkEnd = chunkBegin;
+    for (std::size_t chunk = 1; chunk != threadCount; ++chunk) {
+        const auto chunkEnd = std::next(chunkBegin, static_cast<std::ptrdiff_t>(chunkSize + (chunk < remainder ? 1 : 0)));
+        futures.emplace_back(std::async(std::launch::async, writeLines, chunkBegin, chunkEnd, std::ref(buffers[chunk - 1])));
+        chunkBegin = chunkEnd;
+    }
+    writeLines(std::begin(container), firstChunkEnd, out);
+
+    // concatenate buffers in order
+    auto totalSize = out.size();
+    for (auto &future : futures) {
+        future.get();
+    }
+    for (const auto &buffer : buffers) {
+        totalSize += buffer.size();
+    }
+    out.reserve(totalSize);
+    for (const auto &buffer : buffers) {
+        out.append(buffer);
     }
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a multiset from the specified array. The \a reflectable is cleared before.
+ * \brief Serializes the elements of the specified \a container as newline-delimited JSON using multiple threads.
+ * \remarks See the overload above for details.
  */
-template <typename Type, Traits::EnableIf<IsMultiSet<Type>> *>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+template <typename Container, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsArray<Container>> * = nullptr>
+std::string toJsonLines(const Container &container, std::size_t threadCount = 0)
 {
-    // clear previous contents of the array
-    reflectable.clear();
+    auto out = std::string();
+    toJsonLines<Container, Policy>(container, out, threadCount);
+    return out;
+}
 
-    // pull all array elements of the specified value
-    std::size_t index = 0;
-    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
-        // set error context for current index
+// define functions providing high-level JSON deserialization
+
+/*!
+ * \brief Deserializes the specified JSON \a doc to \tparam Type which is a custom type or can be mapped to an object.
+ */
+template <typename Type, Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>> * = nullptr>
+Type fromJsonValue(const RAPIDJSON_NAMESPACE::Value &doc, JsonDeserializationErrors *errors = nullptr)
+{
+    if (!doc.IsObject()) {
         if (errors) {
-            errors->currentIndex = index;
+            errors->reportTypeMismatch<Type>(doc.GetType());
         }
-        ++index;
-        typename Type::value_type itemObj;
-        pull(itemObj, item, errors);
-        reflectable.emplace(move(itemObj));
+        return Type();
     }
 
-    // clear error context
-    if (errors) {
-        errors->currentIndex = JsonDeserializationError::noIndex;
+    Type res;
+    if constexpr (IsJsonSerializable<Type>::value) {
+        pull<Type>(res, doc.GetObject(), errors);
+    } else {
+        pull<Type>(res, doc, errors);
     }
+    return res;
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a set from the specified array. The \a reflectable is cleared before.
+ * \brief Deserializes the specified JSON \a doc to \tparam Type which is an integer, float or boolean.
  */
-template <typename Type, Traits::EnableIf<IsSet<Type>> *>
-void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstArray array, JsonDeserializationErrors *errors)
+template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
+Type fromJsonValue(const RAPIDJSON_NAMESPACE::Value &doc, JsonDeserializationErrors *errors = nullptr)
 {
-    // clear previous contents of the array
-    reflectable.clear();
-
-    // pull all array elements of the specified value
-    std::size_t index = 0;
-    for (const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &item : array) {
-        // set error context for current index
+    if (!doc.Is<Type>()) {
         if (errors) {
-            errors->currentIndex = index;
-        }
-        ++index;
-        typename Type::value_type itemObj;
-        pull(itemObj, item, errors);
-        if (!reflectable.emplace(move(itemObj)).second) {
-            errors->reportUnexpectedDuplicate(JsonType::Array);
+            errors->reportTypeMismatch<Type>(doc.GetType());
         }
+        return Type();
     }
 
-    // clear error context
-    if (errors) {
-        errors->currentIndex = JsonDeserializationError::noIndex;
-    }
+    return doc.Get<Type>();
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a map from the specified value which is checked to contain an object.
+ * \brief Deserializes the specified JSON \a doc to \tparam Type which is a std::string.
  */
-template <typename Type, Traits::EnableIf<IsMapOrHash<Type>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
+Type fromJsonValue(const RAPIDJSON_NAMESPACE::Value &doc, JsonDeserializationErrors *errors = nullptr)
 {
-    if (!value.IsObject()) {
+    if (!doc.IsString()) {
         if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
+            errors->reportTypeMismatch<Type>(doc.GetType());
         }
-        return;
-    }
-    auto obj = value.GetObject();
-    for (auto i = obj.MemberBegin(), end = obj.MemberEnd(); i != end; ++i) {
-        pull(reflectable[i->name.GetString()], i->value, errors);
+        return Type();
     }
+
+    return doc.GetString();
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a multimap from the specified value which is checked to contain an object.
+ * \brief Deserializes the specified JSON \a doc to \tparam Type which can be mapped to an array.
  */
-template <typename Type, Traits::EnableIf<IsMultiMapOrHash<Type>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr>
+Type fromJsonValue(const RAPIDJSON_NAMESPACE::Value &doc, JsonDeserializationErrors *errors = nullptr)
 {
-    if (!value.IsObject()) {
+    if (!doc.IsArray()) {
         if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
-    }
-    auto obj = value.GetObject();
-    for (auto i = obj.MemberBegin(), end = obj.MemberEnd(); i != end; ++i) {
-        if (i->value.GetType() != RAPIDJSON_NAMESPACE::kArrayType) {
-            auto insertedIterator = reflectable.insert(typename Type::value_type(i->name.GetString(), typename Type::mapped_type()));
-            pull(insertedIterator->second, i->value, errors);
-            continue;
-        }
-        const auto array = i->value.GetArray();
-        for (const auto &value : array) {
-            auto insertedIterator = reflectable.insert(typename Type::value_type(i->name.GetString(), typename Type::mapped_type()));
-            pull(insertedIterator->second, value, errors);
+            errors->reportTypeMismatch<Type>(doc.GetType());
         }
+        return Type();
     }
+
+    Type res;
+    pull<Type>(res, doc.GetArray(), errors);
+    return res;
 }
 
+/// \cond
 namespace Detail {
 
 /*!
- * \brief The TuplePullHelper class helps deserializing tuples from JSON arrays.
- * \remarks Assumes that the array bounds have been checked before (to match the size of the tuple).
- */
-template <class Tuple, std::size_t N> struct TuplePullHelper {
-    static void pull(Tuple &tuple, const RAPIDJSON_NAMESPACE::Value::ConstArray value, JsonDeserializationErrors *errors)
-    {
-        TuplePullHelper<Tuple, N - 1>::pull(tuple, value, errors);
-        JsonReflector::pull<typename std::tuple_element<N - 1, Tuple>::type>(std::get<N - 1>(tuple), value[N - 1], errors);
-    }
-};
-
-template <class Tuple> struct TuplePullHelper<Tuple, 1> {
-    static void pull(Tuple &tuple, const RAPIDJSON_NAMESPACE::Value::ConstArray value, JsonDeserializationErrors *errors)
-    {
-        JsonReflector::pull<typename std::tuple_element<0, Tuple>::type>(std::get<0>(tuple), value[0], errors);
-    }
-};
-} // namespace Detail
-
-/*!
- * \brief Pulls the specified \a reflectable which is a tuple from the specified value which is checked to contain an array.
+ * \brief Returns the JSON pointer (RFC 6901) of the value within the specified \a json which ends at the specified \a offset.
+ * \remarks The \a offset is supposed to be determined via BasicJsonReader::offset() of a reader using the same \tparam parseFlags.
+ *          Returns an empty string if \a offset does not denote the end of a token.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::tuple>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <unsigned parseFlags> std::string jsonPointerAt(const char *json, std::size_t jsonSize, std::size_t offset)
 {
-    if (!value.IsArray()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
+    struct Level {
+        bool isArray;
+        std::size_t elementCount;
+        std::string key;
+    };
+    auto levels = std::vector<Level>();
+    auto reader = BasicJsonReader<parseFlags>(json, jsonSize);
+    for (;;) {
+        const auto token = reader.next();
+        switch (token) {
+        case JsonToken::EndObject:
+        case JsonToken::EndArray:
+            levels.pop_back();
+            break;
+        case JsonToken::Key:
+            levels.back().key = reader.key();
+            break;
+        default:
+            if (!levels.empty() && levels.back().isArray) {
+                ++levels.back().elementCount;
+            }
         }
-        return;
-    }
-    const auto array = value.GetArray();
-    if (array.Size() != std::tuple_size<Type>::value) {
-        if (errors) {
-            // FIXME: report expected and actual size
-            errors->reportArraySizeMismatch();
+        if (reader.offset() >= offset) {
+            auto path = std::string();
+            for (const auto &level : levels) {
+                path += '/';
+                if (level.isArray) {
+                    path += std::to_string(level.elementCount - 1);
+                    continue;
+                }
+                for (const auto c : level.key) {
+                    if (c == '~') {
+                        path += "~0";
+                    } else if (c == '/') {
+                        path += "~1";
+                    } else {
+                        path += c;
+                    }
+                }
+            }
+            return path;
+        }
+        if (token == JsonToken::StartObject || token == JsonToken::StartArray) {
+            levels.emplace_back(Level{ token == JsonToken::StartArray, 0, std::string() });
+        } else if (levels.empty()) {
+            return std::string();
         }
-        return;
     }
-    Detail::TuplePullHelper<Type, std::tuple_size<Type>::value>::pull(reflectable, array, errors);
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a pair from the specified value which is checked to contain an array.
+ * \brief Deserializes the specified \a json to \tparam Type throwing a JsonDeserializationFailure on the first error.
+ * \remarks The \a json is read via read() using the parse flags of the specified \tparam Policy. The location of the error is
+ *          determined from the offset of that reader when the error is raised so no context needs to be maintained while
+ *          deserializing (and the reader is instantiated for JsonErrorMode::FailFast so the bookkeeping is not compiled in).
+ * \remarks The rest of the \a json is parsed before throwing so RAPIDJSON_NAMESPACE::ParseResult is thrown instead if the
+ *          \a json is invalid (like fromJson() does when using the other error modes).
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::pair>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy> Type fromJsonFailFast(const char *json, std::size_t jsonSize)
 {
-    if (!value.IsArray()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
+    auto errors = JsonDeserializationErrors();
+    errors.throwOn = JsonDeserializationErrors::ThrowOn::All;
+    BasicJsonReader<Policy::parseFlags, JsonErrorMode::FailFast> reader(json, jsonSize);
+    Type res{};
+    try {
+        reader.next();
+        read(res, reader, &errors);
+    } catch (const JsonDeserializationError &) {
     }
-    const auto array = value.GetArray();
-    if (array.Size() != 2) {
-        if (errors) {
-            // FIXME: report expected and actual size
-            errors->reportArraySizeMismatch();
-        }
-        return;
+    const auto offset = reader.offset();
+    reader.finish();
+    if (errors.empty()) {
+        return res;
     }
-    pull(reflectable.first, array[0], errors);
-    pull(reflectable.second, array[1], errors);
+    const auto &error = errors.front();
+    throw JsonDeserializationFailure{ error.kind, error.expectedType, error.actualType, jsonPointerAt<Policy::parseFlags>(json, jsonSize, offset) };
 }
 
 /*!
- * \brief Pulls the specified \a reflectable which is a unique_ptr from the specified value which might be null.
+ * \brief Deserializes the specified \a json to \tparam Type ignoring all errors.
+ * \remarks The \a json is read via read() using the parse flags of the specified \tparam Policy. The reader is instantiated for
+ *          JsonErrorMode::Ignore so no context is maintained while deserializing. Invalid JSON is still reported by throwing
+ *          RAPIDJSON_NAMESPACE::ParseResult.
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::unique_ptr>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy> Type fromJsonIgnoringErrors(const char *json, std::size_t jsonSize)
 {
-    if (value.IsNull()) {
-        reflectable.reset();
-        return;
-    }
-    reflectable = std::make_unique<typename Type::element_type>();
-    pull(*reflectable, value, errors);
+    BasicJsonReader<Policy::parseFlags, JsonErrorMode::Ignore> reader(json, jsonSize);
+    reader.next();
+    Type res{};
+    read(res, reader, nullptr);
+    reader.finish();
+    return res;
 }
 
+} // namespace Detail
+/// \endcond
+
 /*!
- * \brief Pulls the specified \a reflectable which is a shared_ptr from the specified value which might be null.
+ * \brief Deserializes the specified JSON to \tparam Type.
+ * \remarks The JSON is parsed using the parse flags of the specified \tparam Policy (see JsonPolicy).
+ * \remarks Errors are handled according to the error mode of the specified \tparam Policy. With JsonErrorMode::FailFast, a
+ *          JsonDeserializationFailure is thrown on the first error. With JsonErrorMode::Ignore, errors are not reported. In
+ *          both cases \a errors is not used and the JSON is read without building a document (like by fromJsonSax()).
  */
-template <typename Type, Traits::EnableIf<Traits::IsSpecializationOf<Type, std::shared_ptr>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
 {
-    if (value.IsNull()) {
-        reflectable.reset();
-        return;
+    if constexpr (Policy::errorMode == JsonErrorMode::FailFast) {
+        return Detail::fromJsonFailFast<Type, Policy>(json, jsonSize);
+    } else if constexpr (Policy::errorMode == JsonErrorMode::Ignore) {
+        return Detail::fromJsonIgnoringErrors<Type, Policy>(json, jsonSize);
+    } else {
+        return fromJsonValue<Type>(parseJsonDocFromString<Policy>(json, jsonSize), errors);
     }
-    reflectable = std::make_shared<typename Type::element_type>();
-    pull(*reflectable, value, errors);
 }
 
-/// \cond
-namespace Detail {
-template <typename Variant, std::size_t compiletimeIndex = 0>
-void assignVariantValueByRuntimeIndex(std::size_t runtimeIndex, Variant &variant,
-    const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+/*!
+ * \brief Deserializes the specified JSON to \tparam Type which is a resizable array/vector pulling the elements using multiple threads.
+ * \remarks This is the same as fromJson() except that the elements of the top-level array are pulled in parallel by
+ *          \a threadCount threads (see pullParallel() for details). Nested arrays are still pulled serially.
+ * \remarks The JSON is parsed using the parse flags of the specified \tparam Policy and errors are handled according to its
+ *          error mode (see JsonPolicy). With JsonErrorMode::FailFast, the JSON is read serially like by fromJson() because
+ *          stopping at the first error leaves nothing to parallelize.
+ */
+template <typename Type, typename Policy = DefaultJsonPolicy,
+    Traits::EnableIf<IsArray<Type>, Traits::IsResizable<Type>, Traits::Not<std::is_same<typename Type::value_type, bool>>> * = nullptr>
+Type fromJsonParallel(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr, std::size_t threadCount = 0)
 {
-    if constexpr (compiletimeIndex < std::variant_size_v<Variant>) {
-        if (compiletimeIndex == runtimeIndex) {
-            if constexpr (std::is_same_v<std::variant_alternative_t<compiletimeIndex, Variant>, std::monostate>) {
-                variant = std::monostate{};
-            } else {
-                pull(variant.template emplace<compiletimeIndex>(), value, errors);
-            }
-        } else {
-            assignVariantValueByRuntimeIndex<Variant, compiletimeIndex + 1>(runtimeIndex, variant, value, errors);
-        }
+    if constexpr (Policy::errorMode == JsonErrorMode::FailFast) {
+        return Detail::fromJsonFailFast<Type, Policy>(json, jsonSize);
     } else {
-        if (errors) {
-            errors->emplace_back(JsonDeserializationErrorKind::InvalidVariantIndex, JsonType::Number, JsonType::Number, errors->currentRecord,
-                errors->currentMember, errors->currentIndex);
+        if constexpr (Policy::errorMode == JsonErrorMode::Ignore) {
+            errors = nullptr;
+        }
+        const RAPIDJSON_NAMESPACE::Document doc(parseJsonDocFromString<Policy>(json, jsonSize));
+        if (!doc.IsArray()) {
+            if (errors) {
+                errors->reportTypeMismatch<Type>(doc.GetType());
+            }
+            return Type();
         }
+
+        Type res;
+        pullParallel(res, doc.GetArray(), errors, threadCount);
+        return res;
     }
 }
-} // namespace Detail
-/// \endcond
 
 /*!
- * \brief Pulls the specified \a reflectable which is a variant from the specified value which might be null.
+ * \brief Deserializes the specified JSON from an null-terminated C-string to \tparam Type.
  */
-template <typename Type, Traits::EnableIf<IsVariant<Type>> *>
-void pull(Type &reflectable, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy> Type fromJson(const char *json, JsonDeserializationErrors *errors = nullptr)
 {
-    if (!value.IsObject()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
-        }
-        return;
-    }
+    return fromJson<Type, Policy>(json, std::strlen(json), errors);
+}
 
-    auto obj = value.GetObject();
-    auto indexIterator = obj.FindMember("index");
-    auto dataIterator = obj.FindMember("data");
-    if (indexIterator == obj.MemberEnd() || dataIterator == obj.MemberEnd()) {
-        if (errors) {
-            errors->emplace_back(JsonDeserializationErrorKind::InvalidVariantObject, JsonType::Object, JsonType::Object, errors->currentRecord,
-                errors->currentMember, errors->currentIndex);
-        }
-        return;
-    }
-    const auto &indexValue = indexIterator->value;
-    if (!indexValue.IsInt()) {
-        if (errors) {
-            errors->emplace_back(JsonDeserializationErrorKind::InvalidVariantIndex, JsonType::Number, jsonType(indexValue.GetType()),
-                errors->currentRecord, errors->currentMember, errors->currentIndex);
-        }
-        return;
-    }
-    const auto index = indexValue.GetInt();
-    if (index < 0) {
-        errors->emplace_back(JsonDeserializationErrorKind::InvalidVariantIndex, JsonType::Number, JsonType::Number, errors->currentRecord,
-            errors->currentMember, errors->currentIndex);
-        return;
+/*!
+ * \brief Deserializes the specified JSON from an std::string to \tparam Type.
+ */
+template <typename Type, typename Policy = DefaultJsonPolicy> Type fromJson(const std::string &json, JsonDeserializationErrors *errors = nullptr)
+{
+    return fromJson<Type, Policy>(json.data(), json.size(), errors);
+}
+
+/*!
+ * \brief Deserializes the specified JSON to \tparam Type reusing the memory of the specified \a context for parsing.
+ * \remarks This avoids allocating and freeing the memory of the intermediate JSON document for each call which makes
+ *          a difference when deserializing many small messages (see Context).
+ */
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJson(Context &context, const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
+{
+    if constexpr (Policy::errorMode == JsonErrorMode::FailFast) {
+        return Detail::fromJsonFailFast<Type, Policy>(json, jsonSize);
+    } else if constexpr (Policy::errorMode == JsonErrorMode::Ignore) {
+        return Detail::fromJsonIgnoringErrors<Type, Policy>(json, jsonSize);
+    } else {
+        return fromJsonValue<Type>(context.parse<Policy>(json, jsonSize), errors);
     }
-    Detail::assignVariantValueByRuntimeIndex(static_cast<std::size_t>(index), reflectable, dataIterator->value, errors);
 }
 
 /*!
- * \brief Pulls the specified \a reflectable from the specified value iterator which is checked to contain the right type.
+ * \brief Deserializes the specified JSON from an null-terminated C-string to \tparam Type reusing the memory of the specified \a context.
  */
-template <typename Type>
-inline void pull(Type &reflectable, rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ValueIterator &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJson(Context &context, const char *json, JsonDeserializationErrors *errors = nullptr)
 {
-    pull<Type>(reflectable, *value, errors);
-    ++value;
+    return fromJson<Type, Policy>(context, json, std::strlen(json), errors);
 }
 
 /*!
- * \brief Pulls the specified member of \a reflectable which has a custom type from the specified object.
- * \remarks It is checked whether the object actually contains the member. If not, the missing member is ignored. So currently all members
- *          are optional.
+ * \brief Deserializes the specified JSON from an std::string to \tparam Type reusing the memory of the specified \a context.
  */
-template <typename Type>
-inline void pull(Type &reflectable, const char *name, const rapidjson::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,
-    JsonDeserializationErrors *errors)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJson(Context &context, const std::string &json, JsonDeserializationErrors *errors = nullptr)
 {
-    // find member
-    const auto member = value.FindMember(name);
-    if (member == value.MemberEnd()) {
-        return; // TODO: handle member missing
-    }
+    return fromJson<Type, Policy>(context, json.data(), json.size(), errors);
+}
 
-    // set error context for current member
-    const char *previousMember;
-    if (errors) {
-        previousMember = errors->currentMember;
-        errors->currentMember = name;
-    }
+/*!
+ * \brief The JsonLinesReader class reads newline-delimited JSON from an std::istream yielding one \tparam Type per line.
+ * \remarks The stream is read line by line while the records are requested via read() or iterated. The buffer for the
+ *          current line as well as the Context used for parsing are reused for all lines. So the memory usage is bounded by
+ *          the longest line rather than growing with the size of the stream.
+ * \remarks Each line is deserialized like by fromJson() using the specified \tparam Policy.
+ * \remarks Empty lines (also those only containing whitespace) are skipped. Invalid JSON leads to a RAPIDJSON_NAMESPACE::ParseResult
+ *          being thrown like by fromJson(); lineNumber() can be used to determine the affected line.
+ */
+template <typename Type, typename Policy = DefaultJsonPolicy> class JsonLinesReader {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Type *;
+        using reference = const Type &;
 
-    // actually pull value for member
-    pull<Type>(reflectable, member->value, errors);
+        explicit Iterator(JsonLinesReader *reader = nullptr);
+        reference operator*() const;
+        pointer operator->() const;
+        Iterator &operator++();
+        bool operator==(const Iterator &other) const;
+        bool operator!=(const Iterator &other) const;
 
-    // restore previous error context
-    if (errors) {
-        errors->currentMember = previousMember;
-    }
+    private:
+        JsonLinesReader *m_reader;
+        Type m_record;
+    };
+
+    explicit JsonLinesReader(std::istream &stream, JsonDeserializationErrors *errors = nullptr);
+
+    bool read(Type &record);
+    std::size_t lineNumber() const;
+    Iterator begin();
+    Iterator end();
+
+private:
+    std::istream &m_stream;
+    JsonDeserializationErrors *m_errors;
+    Context m_context;
+    std::string m_line;
+    std::size_t m_lineNumber;
+};
+
+/*!
+ * \brief Constructs a new reader for the specified \a stream reporting errors to the specified \a errors.
+ */
+template <typename Type, typename Policy>
+JsonLinesReader<Type, Policy>::JsonLinesReader(std::istream &stream, JsonDeserializationErrors *errors)
+    : m_stream(stream)
+    , m_errors(errors)
+    , m_lineNumber(0)
+{
 }
 
 /*!
- * \brief Pulls the \a reflectable which has a custom type from the specified value which is supposed and checked to contain an object.
+ * \brief Reads the next record into the specified \a record.
+ * \returns Returns whether a record could be read; returns false when the end of the stream has been reached.
  */
-template <typename Type, Traits::DisableIf<IsBuiltInType<Type>> *>
-void pull(Type &reflectable, const RAPIDJSON_NAMESPACE::GenericValue<RAPIDJSON_NAMESPACE::UTF8<char>> &value, JsonDeserializationErrors *errors)
+template <typename Type, typename Policy> bool JsonLinesReader<Type, Policy>::read(Type &record)
 {
-    if (!value.IsObject()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(value.GetType());
+    while (std::getline(m_stream, m_line)) {
+        ++m_lineNumber;
+        if (m_line.find_first_not_of(" \t\r") == std::string::npos) {
+            continue;
         }
-        return;
+        record = fromJson<Type, Policy>(m_context, m_line.data(), m_line.size(), m_errors);
+        return true;
     }
-    pull(reflectable, value.GetObject(), errors);
+    return false;
 }
 
-// define functions providing high-level JSON serialization
-
 /*!
- * \brief Serializes the specified \a reflectable which has a custom type or can be mapped to and object.
+ * \brief Returns the number of the line the last record has been read from (starting at 1).
  */
-template <typename Type, Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>> * = nullptr>
-RAPIDJSON_NAMESPACE::Document toJsonDocument(const Type &reflectable)
+template <typename Type, typename Policy> std::size_t JsonLinesReader<Type, Policy>::lineNumber() const
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kObjectType);
-    push(reflectable, document, document.GetAllocator());
-    return document;
+    return m_lineNumber;
 }
 
 /*!
- * \brief Serializes the specified \a reflectable which is an integer, float or boolean.
+ * \brief Returns an iterator positioned at the next record.
+ * \remarks The records can only be iterated once as they are read from the stream while iterating.
  */
-template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
-RAPIDJSON_NAMESPACE::Document toJsonDocument(Type reflectable)
+template <typename Type, typename Policy> typename JsonLinesReader<Type, Policy>::Iterator JsonLinesReader<Type, Policy>::begin()
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kNumberType);
-    document.Set(reflectable, document.GetAllocator());
-    return document;
+    return Iterator(this);
 }
 
 /*!
- * \brief Serializes the specified \a reflectable which is an std::string.
+ * \brief Returns the iterator representing the end of the stream.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
-RAPIDJSON_NAMESPACE::Document toJsonDocument(const std::string &reflectable)
+template <typename Type, typename Policy> typename JsonLinesReader<Type, Policy>::Iterator JsonLinesReader<Type, Policy>::end()
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
-    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable.data(), reflectable.size()), document.GetAllocator());
-    return document;
+    return Iterator();
 }
 
 /*!
- * \brief Serializes the specified \a reflectable which is a C-string.
+ * \brief Constructs a new iterator reading the first record from the specified \a reader.
+ * \remarks Constructs the end iterator if \a reader is nullptr.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, const char *>> * = nullptr>
-RAPIDJSON_NAMESPACE::Document toJsonDocument(const char *reflectable)
+template <typename Type, typename Policy>
+JsonLinesReader<Type, Policy>::Iterator::Iterator(JsonLinesReader *reader)
+    : m_reader(reader)
+    , m_record()
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
-    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable), document.GetAllocator());
-    return document;
+    ++*this;
+}
+
+template <typename Type, typename Policy> const Type &JsonLinesReader<Type, Policy>::Iterator::operator*() const
+{
+    return m_record;
+}
+
+template <typename Type, typename Policy> const Type *JsonLinesReader<Type, Policy>::Iterator::operator->() const
+{
+    return &m_record;
 }
 
 /*!
- * \brief Serializes the specified \a reflectable which is a C-string.
+ * \brief Reads the next record; turns the iterator into the end iterator if there are no further records.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string_view>> * = nullptr>
-RAPIDJSON_NAMESPACE::Document toJsonDocument(std::string_view reflectable)
+template <typename Type, typename Policy> typename JsonLinesReader<Type, Policy>::Iterator &JsonLinesReader<Type, Policy>::Iterator::operator++()
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kStringType);
-    document.SetString(RAPIDJSON_NAMESPACE::StringRef(reflectable.data(), reflectable.size()), document.GetAllocator());
-    return document;
+    if (m_reader && !m_reader->read(m_record)) {
+        m_reader = nullptr;
+    }
+    return *this;
+}
+
+template <typename Type, typename Policy> bool JsonLinesReader<Type, Policy>::Iterator::operator==(const Iterator &other) const
+{
+    return m_reader == other.m_reader;
+}
+
+template <typename Type, typename Policy> bool JsonLinesReader<Type, Policy>::Iterator::operator!=(const Iterator &other) const
+{
+    return m_reader != other.m_reader;
 }
 
 /*!
- * \brief Serializes the specified \a reflectable which can be mapped to an array.
+ * \brief Deserializes the specified JSON to \tparam Type without building an intermediate JSON document.
+ * \remarks The target object is populated via the read() functions while the JSON is parsed by BasicJsonReader using the parse
+ *          flags of the specified \tparam Policy. So the peak memory usage is bounded by the target object rather than the target
+ *          object plus the JSON document. Errors are reported in the same way as by fromJson(). This includes content following
+ *          the root value which leads to RAPIDJSON_NAMESPACE::ParseResult being thrown.
  */
-template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr> RAPIDJSON_NAMESPACE::Document toJsonDocument(const Type &reflectable)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJsonSax(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
 {
-    RAPIDJSON_NAMESPACE::Document document(RAPIDJSON_NAMESPACE::kArrayType);
-    push(reflectable, document, document.GetAllocator());
-    return document;
+    BasicJsonReader<Policy::parseFlags> reader(json, jsonSize);
+    reader.next();
+    Type res{};
+    read(res, reader, errors);
+    reader.finish();
+    return res;
 }
 
 /*!
- * \brief Serializes the specified \a reflectable.
+ * \brief Deserializes the specified JSON from an null-terminated C-string to \tparam Type without building an intermediate JSON document.
  */
-template <typename Type,
-    Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>, std::is_integral<Type>, std::is_floating_point<Type>,
-        Traits::IsString<Type>, IsArray<Type>> * = nullptr>
-RAPIDJSON_NAMESPACE::StringBuffer toJson(const Type &reflectable)
+template <typename Type, typename Policy = DefaultJsonPolicy> Type fromJsonSax(const char *json, JsonDeserializationErrors *errors = nullptr)
 {
-    auto document(toJsonDocument(reflectable));
-    return serializeJsonDocToString(document);
+    return fromJsonSax<Type, Policy>(json, std::strlen(json), errors);
 }
 
-// define functions providing high-level JSON deserialization
-
 /*!
- * \brief Deserializes the specified JSON to \tparam Type which is a custom type or can be mapped to an object.
+ * \brief Deserializes the specified JSON from an std::string to \tparam Type without building an intermediate JSON document.
  */
-template <typename Type, Traits::EnableIfAny<IsJsonSerializable<Type>, IsMapOrHash<Type>, IsMultiMapOrHash<Type>> * = nullptr>
-Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy> Type fromJsonSax(const std::string &json, JsonDeserializationErrors *errors = nullptr)
 {
-    RAPIDJSON_NAMESPACE::Document doc(parseJsonDocFromString(json, jsonSize));
-    if (!doc.IsObject()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(doc.GetType());
-        }
-        return Type();
-    }
+    return fromJsonSax<Type, Policy>(json.data(), json.size(), errors);
+}
 
-    Type res;
-    pull<Type>(res, doc.GetObject(), errors);
+/*!
+ * \brief Deserializes only the members contained by the specified \a mask from the specified JSON to \tparam Type which is a custom type.
+ * \remarks Members not contained by the \a mask keep their default value. The JSON is read via BasicJsonReader using the parse flags
+ *          of the specified \tparam Policy (like fromJsonSax() does) so the values of these members are skipped without building a
+ *          document or converting them.
+ */
+template <typename Type, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+Type fromJson(const char *json, std::size_t jsonSize, const JsonFieldMask &mask, JsonDeserializationErrors *errors = nullptr)
+{
+    BasicJsonReader<Policy::parseFlags> reader(json, jsonSize);
+    reader.next();
+    Type res{};
+    read(res, reader, mask, errors);
+    reader.finish();
     return res;
 }
 
 /*!
- * \brief Deserializes the specified JSON to \tparam Type which is an integer, float or boolean.
+ * \brief Deserializes only the members contained by the specified \a mask from the specified JSON to \tparam Type which is a custom type.
  */
-template <typename Type, Traits::EnableIfAny<std::is_integral<Type>, std::is_floating_point<Type>> * = nullptr>
-Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy, Traits::EnableIf<IsJsonSerializable<Type>> * = nullptr>
+Type fromJson(const std::string &json, const JsonFieldMask &mask, JsonDeserializationErrors *errors = nullptr)
 {
-    RAPIDJSON_NAMESPACE::Document doc(parseJsonDocFromString(json, jsonSize));
-    if (!doc.Is<Type>()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(doc.GetType());
-        }
-        return Type();
-    }
-
-    return doc.Get<Type>();
+    return fromJson<Type, Policy>(json.data(), json.size(), mask, errors);
 }
 
 /*!
- * \brief Deserializes the specified JSON to \tparam Type which is a std::string.
+ * \brief Applies the specified JSON merge patch (RFC 7386) to the specified \a reflectable in-place.
+ * \remarks Only the members addressed by the patch are updated (see mergePatch() for details). The patch is read via BasicJsonReader
+ *          using the parse flags of the specified \tparam Policy so no document is built. Errors are reported like by fromJson();
+ *          invalid JSON leads to RAPIDJSON_NAMESPACE::ParseResult being thrown. Note that the patch might have been applied partially
+ *          in these cases.
  */
-template <typename Type, Traits::EnableIf<std::is_same<Type, std::string>> * = nullptr>
-Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+void applyMergePatch(Type &reflectable, const char *patch, std::size_t patchSize, JsonDeserializationErrors *errors = nullptr)
 {
-    RAPIDJSON_NAMESPACE::Document doc(parseJsonDocFromString(json, jsonSize));
-    if (!doc.IsString()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(doc.GetType());
-        }
-        return Type();
-    }
-
-    return doc.GetString();
+    BasicJsonReader<Policy::parseFlags> reader(patch, patchSize);
+    reader.next();
+    mergePatch(reflectable, reader, errors);
+    reader.finish();
 }
 
 /*!
- * \brief Deserializes the specified JSON to \tparam Type which can be mapped to an array.
+ * \brief Applies the specified JSON merge patch (RFC 7386) to the specified \a reflectable in-place.
  */
-template <typename Type, Traits::EnableIf<IsArray<Type>> * = nullptr>
-Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+void applyMergePatch(Type &reflectable, const std::string &patch, JsonDeserializationErrors *errors = nullptr)
 {
-    RAPIDJSON_NAMESPACE::Document doc(parseJsonDocFromString(json, jsonSize));
-    if (!doc.IsArray()) {
-        if (errors) {
-            errors->reportTypeMismatch<Type>(doc.GetType());
-        }
-        return Type();
-    }
-
-    Type res;
-    pull<Type>(res, doc.GetArray(), errors);
-    return res;
+    applyMergePatch<Type, Policy>(reflectable, patch.data(), patch.size(), errors);
 }
 
 /*!
- * \brief Deserializes the specified JSON from an null-terminated C-string to \tparam Type.
+ * \brief Deserializes the specified JSON to \tparam Type parsing the specified \a buffer in-situ.
+ * \remarks Works like fromJsonSax() but strings are decoded within the \a buffer itself. So std::string_view and const char *
+ *          members are actually populated and point into the \a buffer instead of being skipped. Besides, std::string
+ *          members are assigned directly from the \a buffer.
+ * \remarks The \a buffer does not need to be null-terminated. It is modified and must outlive the deserialized object if
+ *          it contains std::string_view or const char * members.
  */
-template <typename Type> Type fromJson(const char *json, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy>
+Type fromJsonInsitu(char *buffer, std::size_t bufferSize, JsonDeserializationErrors *errors = nullptr)
 {
-    return fromJson<Type>(json, std::strlen(json), errors);
+    using Reader = BasicJsonReader<Policy::parseFlags>;
+    Reader reader(typename Reader::Insitu(), buffer, bufferSize);
+    reader.next();
+    Type res{};
+    read(res, reader, errors);
+    reader.finish();
+    return res;
 }
 
 /*!
- * \brief Deserializes the specified JSON from an std::string to \tparam Type.
+ * \brief Deserializes the specified JSON from an std::string to \tparam Type parsing it in-situ.
+ * \remarks The \a json is modified and must outlive the deserialized object (see fromJsonInsitu() above).
  */
-template <typename Type> Type fromJson(const std::string &json, JsonDeserializationErrors *errors = nullptr)
+template <typename Type, typename Policy = DefaultJsonPolicy> Type fromJsonInsitu(std::string &json, JsonDeserializationErrors *errors = nullptr)
 {
-    return fromJson<Type>(json.data(), json.size(), errors);
+    return fromJsonInsitu<Type, Policy>(json.data(), json.size(), errors);
 }
 
 } // namespace JsonReflector
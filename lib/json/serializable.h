@@ -25,10 +25,26 @@ template <typename Type> struct JsonSerializable {
 
     // high-level API
     RAPIDJSON_NAMESPACE::StringBuffer toJson() const;
+    template <typename Policy> RAPIDJSON_NAMESPACE::StringBuffer toJson() const;
+    template <typename OutputStream> void toJson(OutputStream &out) const;
     RAPIDJSON_NAMESPACE::Document toJsonDocument() const;
+    JsonReflector::Context::Document &toJsonDocument(JsonReflector::Context &context) const;
+    RAPIDJSON_NAMESPACE::StringBuffer toJsonDelta(const Type &baseline) const;
+    RAPIDJSON_NAMESPACE::StringBuffer toJsonWithoutDefaults() const;
     static Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr);
     static Type fromJson(const char *json, JsonDeserializationErrors *errors = nullptr);
     static Type fromJson(const std::string &json, JsonDeserializationErrors *errors = nullptr);
+    template <typename Policy> static Type fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr);
+    template <typename Policy> static Type fromJson(const std::string &json, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJson(JsonReflector::Context &context, const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJson(JsonReflector::Context &context, const std::string &json, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJson(const std::string &json, const JsonReflector::JsonFieldMask &mask, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJsonSax(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJsonSax(const std::string &json, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJsonInsitu(char *buffer, std::size_t bufferSize, JsonDeserializationErrors *errors = nullptr);
+    static Type fromJsonInsitu(std::string &json, JsonDeserializationErrors *errors = nullptr);
+    void applyMergePatch(const char *patch, std::size_t patchSize, JsonDeserializationErrors *errors = nullptr);
+    void applyMergePatch(const std::string &patch, JsonDeserializationErrors *errors = nullptr);
 
     static constexpr const char *qualifiedName = "ReflectiveRapidJSON::JsonSerializable";
 };
@@ -58,6 +74,25 @@ template <typename Type> RAPIDJSON_NAMESPACE::StringBuffer JsonSerializable<Type
     return JsonReflector::toJson<Type>(static_cast<const Type &>(*this));
 }
 
+/*!
+ * \brief Converts the object to its JSON representation using the write flags of the specified \tparam Policy.
+ * \remarks See JsonReflector::JsonPolicy for details.
+ */
+template <typename Type> template <typename Policy> RAPIDJSON_NAMESPACE::StringBuffer JsonSerializable<Type>::toJson() const
+{
+    return JsonReflector::toJson<Type, Policy>(static_cast<const Type &>(*this));
+}
+
+/*!
+ * \brief Writes the JSON representation of the object to the specified \a out.
+ * \remarks The \a out might be an std::string or a RAPIDJSON_NAMESPACE::StringBuffer (which are appended to), an std::ostream
+ *          or any other RapidJSON output stream (see JsonReflector::toJson()).
+ */
+template <typename Type> template <typename OutputStream> void JsonSerializable<Type>::toJson(OutputStream &out) const
+{
+    JsonReflector::toJson<Type>(static_cast<const Type &>(*this), out);
+}
+
 /*!
  * \brief Converts the object to its JSON representation (rapidjson::Document).
  * \remarks To obtain a string from the returned buffer, just use its GetString() method.
@@ -67,6 +102,32 @@ template <typename Type> RAPIDJSON_NAMESPACE::Document JsonSerializable<Type>::t
     return JsonReflector::toJsonDocument<Type>(static_cast<const Type &>(*this));
 }
 
+/*!
+ * \brief Converts the object to its JSON representation reusing the memory of the specified \a context.
+ * \remarks The returned document is owned by the \a context and only valid until the \a context is used again.
+ */
+template <typename Type> JsonReflector::Context::Document &JsonSerializable<Type>::toJsonDocument(JsonReflector::Context &context) const
+{
+    return JsonReflector::toJsonDocument<Type>(context, static_cast<const Type &>(*this));
+}
+
+/*!
+ * \brief Converts only the members differing from the specified \a baseline to JSON.
+ * \remarks The result is a JSON merge patch which can be applied to \a baseline via applyMergePatch().
+ */
+template <typename Type> RAPIDJSON_NAMESPACE::StringBuffer JsonSerializable<Type>::toJsonDelta(const Type &baseline) const
+{
+    return JsonReflector::toJsonDelta<Type>(static_cast<const Type &>(*this), baseline);
+}
+
+/*!
+ * \brief Converts the object to JSON omitting members which are equal to their default value.
+ */
+template <typename Type> RAPIDJSON_NAMESPACE::StringBuffer JsonSerializable<Type>::toJsonWithoutDefaults() const
+{
+    return JsonReflector::toJsonWithoutDefaults<Type>(static_cast<const Type &>(*this));
+}
+
 /*!
  * \brief Constructs a new object from the specified JSON.
  */
@@ -91,6 +152,102 @@ template <typename Type> Type JsonSerializable<Type>::fromJson(const std::string
     return JsonReflector::fromJson<Type>(json.data(), json.size(), errors);
 }
 
+/*!
+ * \brief Constructs a new object from the specified JSON using the parse flags of the specified \tparam Policy.
+ * \remarks See JsonReflector::JsonPolicy for details.
+ */
+template <typename Type>
+template <typename Policy>
+Type JsonSerializable<Type>::fromJson(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJson<Type, Policy>(json, jsonSize, errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON using the parse flags of the specified \tparam Policy.
+ * \remarks See JsonReflector::JsonPolicy for details.
+ */
+template <typename Type> template <typename Policy> Type JsonSerializable<Type>::fromJson(const std::string &json, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJson<Type, Policy>(json.data(), json.size(), errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON reusing the memory of the specified \a context for parsing.
+ */
+template <typename Type>
+Type JsonSerializable<Type>::fromJson(JsonReflector::Context &context, const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJson<Type>(context, json, jsonSize, errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON reusing the memory of the specified \a context for parsing.
+ */
+template <typename Type> Type JsonSerializable<Type>::fromJson(JsonReflector::Context &context, const std::string &json, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJson<Type>(context, json.data(), json.size(), errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON only deserializing the members contained by the specified \a mask.
+ */
+template <typename Type>
+Type JsonSerializable<Type>::fromJson(const std::string &json, const JsonReflector::JsonFieldMask &mask, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJson<Type>(json.data(), json.size(), mask, errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON without building an intermediate JSON document.
+ */
+template <typename Type> Type JsonSerializable<Type>::fromJsonSax(const char *json, std::size_t jsonSize, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJsonSax<Type>(json, jsonSize, errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON without building an intermediate JSON document.
+ */
+template <typename Type> Type JsonSerializable<Type>::fromJsonSax(const std::string &json, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJsonSax<Type>(json.data(), json.size(), errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON parsing the \a buffer in-situ.
+ * \remarks The \a buffer is modified and std::string_view members point into it (see JsonReflector::fromJsonInsitu()).
+ */
+template <typename Type> Type JsonSerializable<Type>::fromJsonInsitu(char *buffer, std::size_t bufferSize, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJsonInsitu<Type>(buffer, bufferSize, errors);
+}
+
+/*!
+ * \brief Constructs a new object from the specified JSON parsing it in-situ.
+ * \remarks The \a json is modified and std::string_view members point into it (see JsonReflector::fromJsonInsitu()).
+ */
+template <typename Type> Type JsonSerializable<Type>::fromJsonInsitu(std::string &json, JsonDeserializationErrors *errors)
+{
+    return JsonReflector::fromJsonInsitu<Type>(json.data(), json.size(), errors);
+}
+
+/*!
+ * \brief Applies the specified JSON merge patch (RFC 7386) to the object updating only the addressed members.
+ */
+template <typename Type> void JsonSerializable<Type>::applyMergePatch(const char *patch, std::size_t patchSize, JsonDeserializationErrors *errors)
+{
+    JsonReflector::applyMergePatch<Type>(static_cast<Type &>(*this), patch, patchSize, errors);
+}
+
+/*!
+ * \brief Applies the specified JSON merge patch (RFC 7386) to the object updating only the addressed members.
+ */
+template <typename Type> void JsonSerializable<Type>::applyMergePatch(const std::string &patch, JsonDeserializationErrors *errors)
+{
+    JsonReflector::applyMergePatch<Type>(static_cast<Type &>(*this), patch.data(), patch.size(), errors);
+}
+
 /*!
  * \brief Helps to disambiguate when inheritance is used.
  */
@@ -119,13 +276,24 @@ const JsonSerializable<Type> &as(const Type &serializable)
     template <> struct ReflectiveRapidJSON::AdaptedJsonSerializable<T> : Traits::Bool<true> {                                                        \
     }
 
+/*!
+ * \def The REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME macro makes the enum \a T (de)serialized via the names of its enumerators.
+ * \remarks The code generator emits the name table required for this (see JsonReflector::JsonEnumNames).
+ */
+#define REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME(T)                                                                                          \
+    template <> struct ReflectiveRapidJSON::JsonEnumByName<T> : Traits::Bool<true> {                                                                 \
+    }
+
 /*!
  * \def The REFLECTIVE_RAPIDJSON_PUSH_PRIVATE_MEMBERS macro enables serialization of private members.
  * \remarks For an example, see README.md.
  */
 #define REFLECTIVE_RAPIDJSON_PUSH_PRIVATE_MEMBERS(T)                                                                                                 \
     friend void ::ReflectiveRapidJSON::JsonReflector::push<T>(                                                                                       \
-        const T &reflectable, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
+        const T &reflectable, ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator);              \
+    friend struct ::ReflectiveRapidJSON::JsonReflector::JsonMembers<T>;                                                                              \
+    friend void ::ReflectiveRapidJSON::JsonReflector::pushDelta<T>(const T &reflectable, const T &baseline,                                          \
+        ::RAPIDJSON_NAMESPACE::Value::Object &value, ::RAPIDJSON_NAMESPACE::Document::AllocatorType &allocator)
 
 /*!
  * \def The REFLECTIVE_RAPIDJSON_PULL_PRIVATE_MEMBERS macro enables deserialization of private members.
@@ -134,7 +302,11 @@ const JsonSerializable<Type> &as(const Type &serializable)
 #define REFLECTIVE_RAPIDJSON_PULL_PRIVATE_MEMBERS(T)                                                                                                 \
     friend void ::ReflectiveRapidJSON::JsonReflector::pull<T>(T & reflectable,                                                                       \
         const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>>::ConstObject &value,                                            \
-        ::ReflectiveRapidJSON::JsonDeserializationErrors *errors)
+        ::ReflectiveRapidJSON::JsonDeserializationErrors *errors);                                                                                   \
+    friend bool ::ReflectiveRapidJSON::JsonReflector::pullMember<T>(T & reflectable, std::string_view name,                                          \
+        const ::RAPIDJSON_NAMESPACE::GenericValue<::RAPIDJSON_NAMESPACE::UTF8<char>> &value,                                                         \
+        ::ReflectiveRapidJSON::JsonDeserializationErrors *errors);                                                                                   \
+    friend struct ::ReflectiveRapidJSON::JsonReflector::JsonMembers<T>
 
 /*!
  * \def The REFLECTIVE_RAPIDJSON_ENABLE_PRIVATE_MEMBERS macro enables serialization and deserialization of private members.
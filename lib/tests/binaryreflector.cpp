@@ -11,12 +11,16 @@ using CppUtilities::operator<<; // must be visible prior to the call site
 #include <cppunit/TestFixture.h>
 #include <cppunit/extensions/HelperMacros.h>
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <map>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
@@ -75,7 +79,7 @@ struct ObjectWithVariantsBinary : public BinarySerializable<ObjectWithVariantsBi
 namespace ReflectiveRapidJSON {
 namespace BinaryReflector {
 
-template <> void readCustomType<TestObjectBinary>(BinaryDeserializer &deserializer, TestObjectBinary &customType)
+template <typename Deserializer> void readCustomType(Deserializer &deserializer, TestObjectBinary &customType)
 {
     deserializer.read(customType.number);
     deserializer.read(customType.number2);
@@ -94,7 +98,7 @@ template <> void readCustomType<TestObjectBinary>(BinaryDeserializer &deserializ
     deserializer.read(customType.dateTime);
 }
 
-template <> void writeCustomType<TestObjectBinary>(BinarySerializer &serializer, const TestObjectBinary &customType)
+template <typename Serializer> void writeCustomType(Serializer &serializer, const TestObjectBinary &customType)
 {
     serializer.write(customType.number);
     serializer.write(customType.number2);
@@ -113,26 +117,26 @@ template <> void writeCustomType<TestObjectBinary>(BinarySerializer &serializer,
     serializer.write(customType.dateTime);
 }
 
-template <> void readCustomType<NestingArrayBinary>(BinaryDeserializer &deserializer, NestingArrayBinary &customType)
+template <typename Deserializer> void readCustomType(Deserializer &deserializer, NestingArrayBinary &customType)
 {
     deserializer.read(customType.name);
     deserializer.read(customType.testObjects);
 }
 
-template <> void writeCustomType<NestingArrayBinary>(BinarySerializer &serializer, const NestingArrayBinary &customType)
+template <typename Serializer> void writeCustomType(Serializer &serializer, const NestingArrayBinary &customType)
 {
     serializer.write(customType.name);
     serializer.write(customType.testObjects);
 }
 
-template <> void readCustomType<ObjectWithVariantsBinary>(BinaryDeserializer &deserializer, ObjectWithVariantsBinary &customType)
+template <typename Deserializer> void readCustomType(Deserializer &deserializer, ObjectWithVariantsBinary &customType)
 {
     deserializer.read(customType.someVariant);
     deserializer.read(customType.anotherVariant);
     deserializer.read(customType.yetAnotherVariant);
 }
 
-template <> void writeCustomType<ObjectWithVariantsBinary>(BinarySerializer &serializer, const ObjectWithVariantsBinary &customType)
+template <typename Serializer> void writeCustomType(Serializer &serializer, const ObjectWithVariantsBinary &customType)
 {
     serializer.write(customType.someVariant);
     serializer.write(customType.anotherVariant);
@@ -159,6 +163,11 @@ class BinaryReflectorTests : public TestFixture {
     CPPUNIT_TEST(testSmallSharedPointer);
     CPPUNIT_TEST(testBigSharedPointer);
     CPPUNIT_TEST(testVariant);
+    CPPUNIT_TEST(testBuffer);
+    CPPUNIT_TEST(testContiguousNumberRanges);
+    CPPUNIT_TEST(testLittleEndianFormat);
+    CPPUNIT_TEST(testStringViews);
+    CPPUNIT_TEST(testBinarySize);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -176,6 +185,11 @@ public:
     void testSmallSharedPointer();
     void testBigSharedPointer();
     void testVariant();
+    void testBuffer();
+    void testContiguousNumberRanges();
+    void testLittleEndianFormat();
+    void testStringViews();
+    void testBinarySize();
 
 private:
     vector<unsigned char> m_buffer;
@@ -380,3 +394,241 @@ void BinaryReflectorTests::testVariant()
     CPPUNIT_ASSERT_EQUAL("foo"s, get<0>(deserializedVariants.anotherVariant));
     CPPUNIT_ASSERT_EQUAL(42, get<1>(deserializedVariants.yetAnotherVariant));
 }
+
+void BinaryReflectorTests::testBuffer()
+{
+    // serializing into a buffer yields the same as serializing into a stream
+    vector<std::byte> buffer;
+    m_nestedTestObj.toBinary(buffer);
+    CPPUNIT_ASSERT_EQUAL(m_expectedNestedTestObj.size(), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), m_expectedNestedTestObj.cbegin(),
+        [](std::byte byte, unsigned char expectedByte) { return to_integer<unsigned char>(byte) == expectedByte; }));
+
+    // deserializing from a buffer
+    const auto deserialized = NestingArrayBinary::fromBinary(buffer.data(), buffer.size());
+    CPPUNIT_ASSERT_EQUAL(m_nestedTestObj.name, deserialized.name);
+    CPPUNIT_ASSERT_EQUAL(2_st, deserialized.testObjects.size());
+    for (const auto &testObj : deserialized.testObjects) {
+        assertTestObject(testObj);
+    }
+    CPPUNIT_ASSERT_THROW(NestingArrayBinary::fromBinary(buffer.data(), buffer.size() - 1), CppUtilities::ConversionException);
+
+    // variable-length integers of all sizes are encoded like the stream-based serializer does
+    const std::uint64_t numbers[] = { 0x0, 0x7F, 0x80, 0x3FFF, 0x4000, 0xFFFFFFFF, 0xFFFFFFFFFFFFFF };
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    stream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryReflector::BinarySerializer streamSerializer(&stream);
+    buffer.clear();
+    BinaryReflector::BufferSerializer bufferSerializer(&buffer);
+    for (const auto number : numbers) {
+        streamSerializer.writeVariableLengthUIntBE(number);
+        bufferSerializer.writeVariableLengthUIntBE(number);
+    }
+    const auto streamContents = stream.str();
+    CPPUNIT_ASSERT_EQUAL(streamContents.size(), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), streamContents.cbegin(),
+        [](std::byte byte, char expectedByte) { return to_integer<char>(byte) == expectedByte; }));
+    CPPUNIT_ASSERT_THROW(bufferSerializer.writeVariableLengthUIntBE(0x100000000000000), CppUtilities::ConversionException);
+    BinaryReflector::BufferDeserializer deserializer(buffer);
+    for (const auto number : numbers) {
+        CPPUNIT_ASSERT_EQUAL(number, deserializer.readVariableLengthUIntBE());
+    }
+    CPPUNIT_ASSERT_EQUAL(0_st, deserializer.bytesLeft());
+}
+
+void BinaryReflectorTests::testContiguousNumberRanges()
+{
+    // serialize ranges as a whole; use enough elements to require multiple chunks
+    auto floats = vector<float>{ 1.5f, -2.25f, 0.0f };
+    auto enums = vector<SomeEnumClassBinary>{ SomeEnumClassBinary::Item3, SomeEnumClassBinary::Item1 };
+    auto chars = vector<char>{ 'f', 'o', 'o' };
+    auto bigNumbers = vector<std::uint64_t>(1500);
+    for (auto i = std::size_t(); i != bigNumbers.size(); ++i) {
+        bigNumbers[i] = std::uint64_t(0x0102030405060708) * i;
+    }
+    const auto fixedNumbers = std::array<std::int32_t, 3>{ -1, 2, 0x01020304 };
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    stream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryReflector::BinarySerializer serializer(&stream);
+    serializer.write(floats);
+    serializer.write(enums);
+    serializer.write(chars);
+    serializer.write(bigNumbers);
+    serializer.write(fixedNumbers);
+
+    // compare with serializing element by element
+    stringstream expectedStream(ios_base::in | ios_base::out | ios_base::binary);
+    expectedStream.exceptions(ios_base::failbit | ios_base::badbit);
+    BinaryWriter writer(&expectedStream);
+    writer.writeVariableLengthUIntBE(floats.size());
+    for (const auto number : floats) {
+        writer.writeFloat32BE(number);
+    }
+    writer.writeVariableLengthUIntBE(enums.size());
+    for (const auto enumValue : enums) {
+        writer.writeUInt16BE(static_cast<std::uint16_t>(enumValue));
+    }
+    writer.writeVariableLengthUIntBE(chars.size());
+    for (const auto c : chars) {
+        writer.writeChar(c);
+    }
+    writer.writeVariableLengthUIntBE(bigNumbers.size());
+    for (const auto number : bigNumbers) {
+        writer.writeUInt64BE(number);
+    }
+    writer.writeVariableLengthUIntBE(fixedNumbers.size());
+    for (const auto number : fixedNumbers) {
+        writer.writeInt32BE(number);
+    }
+    const auto serialized = stream.str();
+    CPPUNIT_ASSERT_EQUAL(expectedStream.str(), serialized);
+
+    // deserialize from stream and buffer
+    const auto assertDeserialized = [&](auto &deserializer) {
+        auto deserializedFloats = vector<float>();
+        auto deserializedEnums = vector<SomeEnumClassBinary>();
+        auto deserializedChars = vector<char>();
+        auto deserializedBigNumbers = vector<std::uint64_t>();
+        auto deserializedFixedNumbers = std::array<std::int32_t, 3>();
+        deserializer.read(deserializedFloats);
+        deserializer.read(deserializedEnums);
+        deserializer.read(deserializedChars);
+        deserializer.read(deserializedBigNumbers);
+        deserializer.read(deserializedFixedNumbers);
+        CPPUNIT_ASSERT(floats == deserializedFloats);
+        CPPUNIT_ASSERT(enums == deserializedEnums);
+        CPPUNIT_ASSERT(chars == deserializedChars);
+        CPPUNIT_ASSERT(bigNumbers == deserializedBigNumbers);
+        CPPUNIT_ASSERT(fixedNumbers == deserializedFixedNumbers);
+    };
+    BinaryReflector::BinaryDeserializer streamDeserializer(&stream);
+    assertDeserialized(streamDeserializer);
+    const auto buffer = vector<std::byte>(reinterpret_cast<const std::byte *>(serialized.data()),
+        reinterpret_cast<const std::byte *>(serialized.data() + serialized.size()));
+    BinaryReflector::BufferDeserializer bufferDeserializer(buffer);
+    assertDeserialized(bufferDeserializer);
+
+    // the size of std::array must match
+    auto tooSmallArray = std::array<std::int32_t, 2>();
+    BinaryReflector::BufferDeserializer arrayDeserializer(buffer.data() + buffer.size() - 13, 13);
+    CPPUNIT_ASSERT_THROW(arrayDeserializer.read(tooSmallArray), CppUtilities::ConversionException);
+
+    // a size exceeding the buffer is rejected before allocating
+    const auto corruptedSize = vector<std::byte>{ std::byte(0x01), std::byte(0xFF), std::byte(0xFF), std::byte(0xFF), std::byte(0xFF),
+        std::byte(0xFF), std::byte(0xFF), std::byte(0xFF), std::byte(0x00) };
+    auto deserializedBigNumbers = vector<std::uint64_t>();
+    BinaryReflector::BufferDeserializer corruptedDeserializer(corruptedSize);
+    CPPUNIT_ASSERT_THROW(corruptedDeserializer.read(deserializedBigNumbers), CppUtilities::ConversionException);
+    CPPUNIT_ASSERT_EQUAL(0_st, deserializedBigNumbers.capacity());
+}
+
+void BinaryReflectorTests::testLittleEndianFormat()
+{
+    // serialize numbers in little-endian format
+    const auto numbers = vector<std::uint32_t>{ 0x01020304 };
+    const auto fixedNumbers = std::array<std::int16_t, 2>{ 0x0102, -2 };
+    vector<std::byte> buffer;
+    BinaryReflector::BufferSerializer serializer(&buffer, BinaryReflector::BinaryFormat::LittleEndian);
+    serializer.writeHeader();
+    serializer.write(numbers);
+    serializer.write(fixedNumbers);
+    serializer.write(std::uint64_t(0x0102030405060708));
+    serializer.write(1.0);
+    const auto expected = vector<unsigned char>{
+        'R', 'R', 'J', 'L', // header
+        0x81, 0x04, 0x03, 0x02, 0x01, // numbers
+        0x82, 0x02, 0x01, 0xFE, 0xFF, // fixedNumbers
+        0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01, // std::uint64_t
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, // double
+    };
+    CPPUNIT_ASSERT_EQUAL(expected.size(), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), expected.cbegin(),
+        [](std::byte byte, unsigned char expectedByte) { return to_integer<unsigned char>(byte) == expectedByte; }));
+
+    // the stream-based serializer produces the same
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    stream.exceptions(ios_base::failbit | ios_base::badbit);
+    m_nestedTestObj.toBinary(stream, BinaryReflector::BinaryFormat::LittleEndian);
+    buffer.clear();
+    m_nestedTestObj.toBinary(buffer, BinaryReflector::BinaryFormat::LittleEndian);
+    const auto streamContents = stream.str();
+    CPPUNIT_ASSERT_EQUAL(streamContents.size(), buffer.size());
+    CPPUNIT_ASSERT(equal(buffer.cbegin(), buffer.cend(), streamContents.cbegin(),
+        [](std::byte byte, char expectedByte) { return to_integer<char>(byte) == expectedByte; }));
+
+    // deserialize from stream and buffer
+    for (const auto &deserialized : { NestingArrayBinary::fromBinary(stream, BinaryReflector::BinaryFormat::LittleEndian),
+             NestingArrayBinary::fromBinary(buffer.data(), buffer.size(), BinaryReflector::BinaryFormat::LittleEndian) }) {
+        CPPUNIT_ASSERT_EQUAL(m_nestedTestObj.name, deserialized.name);
+        CPPUNIT_ASSERT_EQUAL(2_st, deserialized.testObjects.size());
+        for (const auto &testObj : deserialized.testObjects) {
+            assertTestObject(testObj);
+        }
+    }
+
+    // the header is checked
+    const auto bigEndianData = vector<std::byte>(reinterpret_cast<const std::byte *>(m_expectedNestedTestObj.data()),
+        reinterpret_cast<const std::byte *>(m_expectedNestedTestObj.data() + m_expectedNestedTestObj.size()));
+    CPPUNIT_ASSERT_THROW(NestingArrayBinary::fromBinary(bigEndianData.data(), bigEndianData.size(), BinaryReflector::BinaryFormat::LittleEndian),
+        CppUtilities::ConversionException);
+}
+
+void BinaryReflectorTests::testStringViews()
+{
+    const auto strings = vector<string_view>{ "foo", "", "bar" };
+    vector<std::byte> buffer;
+    BinaryReflector::BufferSerializer serializer(&buffer);
+    serializer.write(strings);
+    serializer.write(string("baz"));
+
+    // string views reference the buffer
+    BinaryReflector::BufferDeserializer deserializer(buffer);
+    auto deserializedStrings = vector<string_view>();
+    auto deserializedString = string_view();
+    deserializer.read(deserializedStrings);
+    deserializer.read(deserializedString);
+    CPPUNIT_ASSERT(strings == deserializedStrings);
+    CPPUNIT_ASSERT_EQUAL("baz"sv, deserializedString);
+    const auto *const bufferBegin = reinterpret_cast<const char *>(buffer.data());
+    const auto *const bufferEnd = bufferBegin + buffer.size();
+    CPPUNIT_ASSERT(deserializedString.data() >= bufferBegin && deserializedString.data() + deserializedString.size() == bufferEnd);
+    CPPUNIT_ASSERT_THROW(deserializer.read(deserializedString), CppUtilities::ConversionException);
+
+    // the stream-based deserializer can not provide string views
+    stringstream stream(ios_base::in | ios_base::out | ios_base::binary);
+    stream.write(bufferBegin, static_cast<streamsize>(buffer.size()));
+    BinaryReflector::BinaryDeserializer streamDeserializer(&stream);
+    CPPUNIT_ASSERT_THROW(streamDeserializer.read(deserializedStrings), CppUtilities::ConversionException);
+}
+
+void BinaryReflectorTests::testBinarySize()
+{
+    // custom types
+    CPPUNIT_ASSERT_EQUAL(m_expectedTestObj.size(), BinaryReflector::binarySize(m_testObj));
+    CPPUNIT_ASSERT_EQUAL(m_expectedNestedTestObj.size(), m_nestedTestObj.binarySize());
+    CPPUNIT_ASSERT_EQUAL(m_expectedNestedTestObj.size() + 4, m_nestedTestObj.binarySize(BinaryReflector::BinaryFormat::LittleEndian));
+
+    // built-in types
+    const auto assertSize = [](const auto &value) {
+        vector<std::byte> buffer;
+        BinaryReflector::BufferSerializer(&buffer).write(value);
+        CPPUNIT_ASSERT_EQUAL(buffer.size(), BinaryReflector::binarySize(value));
+    };
+    assertSize(string(200, 'x'));
+    assertSize(vector<double>(300));
+    assertSize(vector<string>{ "foo", string(0x4000, 'y') });
+    assertSize(map<string, std::uint16_t>{ { "foo", 1 }, { "bar", 2 } });
+    assertSize(variant<monostate, std::int32_t, string>("foo"));
+    assertSize(variant<monostate, std::int32_t, string>());
+    assertSize(make_unique<std::int64_t>(5));
+    assertSize(unique_ptr<std::int64_t>());
+    const auto sharedNumber = make_shared<std::int64_t>(5);
+    assertSize(vector<shared_ptr<std::int64_t>>{ sharedNumber, sharedNumber, nullptr });
+    assertSize(std::numeric_limits<std::uint64_t>::max());
+
+    // the buffer can be allocated at once
+    vector<std::byte> buffer;
+    buffer.reserve(m_nestedTestObj.binarySize());
+    m_nestedTestObj.toBinary(buffer);
+    CPPUNIT_ASSERT_EQUAL(buffer.size(), buffer.capacity());
+}
@@ -40,6 +40,27 @@ struct NestingArrayHana : public JsonSerializable<NestingArrayHana> {
     BOOST_HANA_DEFINE_STRUCT(NestingArrayHana, (string, name), (vector<TestObjectHana>, testObjects));
 };
 
+struct PushOnlyObjectHana {
+    int number;
+};
+
+struct NestingPushOnlyObjectHana : public JsonSerializable<NestingPushOnlyObjectHana> {
+    BOOST_HANA_DEFINE_STRUCT(NestingPushOnlyObjectHana, (string, name), (PushOnlyObjectHana, pushOnlyObj));
+};
+
+namespace ReflectiveRapidJSON {
+namespace JsonReflector {
+
+// provide custom serialization for PushOnlyObjectHana by only specializing push (it is not a Boost.Hana struct)
+template <> inline void push<PushOnlyObjectHana>(const PushOnlyObjectHana &reflectable, Value &value, Document::AllocatorType &allocator)
+{
+    const auto str = "#" + std::to_string(reflectable.number);
+    value.SetString(str.data(), rapidJsonSize(str.size()), allocator);
+}
+
+} // namespace JsonReflector
+} // namespace ReflectiveRapidJSON
+
 /// \endcond
 
 /*!
@@ -111,6 +132,12 @@ void JsonReflectorBoostHanaTests::testSerializeNestedObjects()
     CPPUNIT_ASSERT_EQUAL(
         "{\"name\":\"nesting\",\"testObj\":{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false}}"s,
         string(nestingObj.toJson().GetString()));
+    auto changedObj(nestingObj);
+    changedObj.testObj.text = "changed";
+    CPPUNIT_ASSERT_EQUAL("{\"testObj\":{\"text\":\"changed\"}}"s, string(changedObj.toJsonDelta(nestingObj).GetString()));
+    CPPUNIT_ASSERT_EQUAL(
+        "{\"name\":\"nesting\",\"testObj\":{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"changed\"}}"s,
+        string(changedObj.toJsonWithoutDefaults().GetString()));
     NestingArrayHana nestingArray;
     nestingArray.name = "nesting2";
     nestingArray.testObjects.emplace_back(testObj);
@@ -119,6 +146,12 @@ void JsonReflectorBoostHanaTests::testSerializeNestedObjects()
     CPPUNIT_ASSERT_EQUAL(
         "{\"name\":\"nesting2\",\"testObjects\":[{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false},{\"number\":43,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false}]}"s,
         string(nestingArray.toJson().GetString()));
+
+    // custom types only providing push() are written via an intermediate value even though the Boost.Hana integration is used
+    NestingPushOnlyObjectHana nestingPushOnlyObj;
+    nestingPushOnlyObj.name = "nesting3";
+    nestingPushOnlyObj.pushOnlyObj.number = 5;
+    CPPUNIT_ASSERT_EQUAL("{\"name\":\"nesting3\",\"pushOnlyObj\":\"#5\"}"s, string(nestingPushOnlyObj.toJson().GetString()));
 }
 
 /*!
@@ -151,6 +184,13 @@ void JsonReflectorBoostHanaTests::testDeserializeNestedObjects()
     CPPUNIT_ASSERT_EQUAL("test"s, testObj.text);
     CPPUNIT_ASSERT_EQUAL(false, testObj.boolean);
 
+    auto patchedObj(nestingObj);
+    patchedObj.applyMergePatch("{\"testObj\":{\"number\":43,\"text\":null}}"s);
+    CPPUNIT_ASSERT_EQUAL("nesting"s, patchedObj.name);
+    CPPUNIT_ASSERT_EQUAL(43, patchedObj.testObj.number);
+    CPPUNIT_ASSERT_EQUAL(string(), patchedObj.testObj.text);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2, 3, 4 }), patchedObj.testObj.numbers);
+
     const NestingArrayHana nestingArray(
         NestingArrayHana::fromJson("{\"name\":\"nesting2\",\"testObjects\":[{\"number\":42,\"number2\":3.141592653589793,"
                                    "\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false},{\"number\":43,\"number2\":3."
@@ -15,7 +15,10 @@ using CppUtilities::operator<<; // must be visible prior to the call site
 #include <rapidjson/writer.h>
 
 #include <iostream>
+#include <limits>
 #include <map>
+#include <optional>
+#include <sstream>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -44,6 +47,14 @@ enum class SomeEnumClass {
     Item3,
 };
 
+enum class SomeNamedEnum {
+    Red,
+    Green,
+    Blue,
+};
+
+REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME(SomeNamedEnum);
+
 struct TestObject : public JsonSerializable<TestObject> {
     int number;
     double number2;
@@ -73,10 +84,68 @@ struct NestingArray : public JsonSerializable<NestingArray> {
     vector<TestObject> testObjects;
 };
 
+struct CustomObject {
+    int number;
+};
+
 // pretend serialization code for structs has been generated
 namespace ReflectiveRapidJSON {
 namespace JsonReflector {
 
+// provide custom (de)serialization for CustomObject by only specializing push and pull (without JsonMembers specialization)
+template <> inline void push<CustomObject>(const CustomObject &reflectable, Value &value, Document::AllocatorType &allocator)
+{
+    const auto str = "#" + std::to_string(reflectable.number);
+    value.SetString(str.data(), rapidJsonSize(str.size()), allocator);
+}
+
+template <> inline void pull<CustomObject>(CustomObject &reflectable, const GenericValue<UTF8<char>> &value, JsonDeserializationErrors *errors)
+{
+    auto str = std::string();
+    pull(str, value, errors);
+    if (!value.IsString()) {
+        return;
+    }
+    try {
+        if (!str.empty() && str.front() == '#') {
+            reflectable.number = stringToNumber<int>(str.substr(1));
+            return;
+        }
+    } catch (const ConversionException &) {
+    }
+    if (errors) {
+        errors->reportConversionError(JsonType::String);
+    }
+}
+
+template <> struct JsonEnumNames<SomeNamedEnum> {
+    static constexpr JsonMemberName name(SomeNamedEnum value)
+    {
+        switch (value) {
+        case SomeNamedEnum::Red:
+            return makeJsonMemberName("Red", "\"Red\"");
+        case SomeNamedEnum::Green:
+            return makeJsonMemberName("Green", "\"Green\"");
+        case SomeNamedEnum::Blue:
+            return makeJsonMemberName("Blue", "\"Blue\"");
+        default:
+            return JsonMemberName();
+        }
+    }
+    static constexpr std::uint32_t hashSeed = 0u;
+    static constexpr std::uint32_t hashMask = 7u;
+    static constexpr JsonEnumSlot<SomeNamedEnum> slots[] = {
+        { "Blue", SomeNamedEnum::Blue },
+        {},
+        {},
+        { "Red", SomeNamedEnum::Red },
+        {},
+        {},
+        {},
+        { "Green", SomeNamedEnum::Green },
+    };
+};
+
 template <> inline void push<TestObject>(const TestObject &reflectable, Value::Object &value, Document::AllocatorType &allocator)
 {
     push(reflectable.number, "number", value, allocator);
@@ -99,8 +168,8 @@ template <> inline void push<TestObject>(const TestObject &reflectable, Value::O
 
 template <> inline void push<NestingObject>(const NestingObject &reflectable, Value::Object &value, Document::AllocatorType &allocator)
 {
-    push(reflectable.name, "name", value, allocator);
-    push(reflectable.testObj, "testObj", value, allocator);
+    push(reflectable.name, makeJsonMemberName("name", "\"name\""), value, allocator);
+    push(reflectable.testObj, makeJsonMemberName("testObj", "\"testObj\""), value, allocator);
 }
 
 template <> inline void push<NestingArray>(const NestingArray &reflectable, Value::Object &value, Document::AllocatorType &allocator)
@@ -109,6 +178,46 @@ template <> inline void push<NestingArray>(const NestingArray &reflectable, Valu
     push(reflectable.testObjects, "testObjects", value, allocator);
 }
 
+template <>
+inline void pushDelta<TestObject>(const TestObject &reflectable, const TestObject &baseline, Value::Object &value, Document::AllocatorType &allocator)
+{
+    pushDelta(reflectable.number, baseline.number, makeJsonMemberName("number", "\"number\""), value, allocator);
+    pushDelta(reflectable.number2, baseline.number2, makeJsonMemberName("number2", "\"number2\""), value, allocator);
+    pushDelta(reflectable.numbers, baseline.numbers, makeJsonMemberName("numbers", "\"numbers\""), value, allocator);
+    pushDelta(reflectable.text, baseline.text, makeJsonMemberName("text", "\"text\""), value, allocator);
+    pushDelta(reflectable.boolean, baseline.boolean, makeJsonMemberName("boolean", "\"boolean\""), value, allocator);
+    pushDelta(reflectable.someMap, baseline.someMap, makeJsonMemberName("someMap", "\"someMap\""), value, allocator);
+    pushDelta(reflectable.someHash, baseline.someHash, makeJsonMemberName("someHash", "\"someHash\""), value, allocator);
+    pushDelta(reflectable.someMultimap, baseline.someMultimap, makeJsonMemberName("someMultimap", "\"someMultimap\""), value, allocator);
+    pushDelta(reflectable.someMultiHash, baseline.someMultiHash, makeJsonMemberName("someMultiHash", "\"someMultiHash\""), value, allocator);
+    pushDelta(reflectable.someSet, baseline.someSet, makeJsonMemberName("someSet", "\"someSet\""), value, allocator);
+    pushDelta(reflectable.someMultiset, baseline.someMultiset, makeJsonMemberName("someMultiset", "\"someMultiset\""), value, allocator);
+    pushDelta(reflectable.someUnorderedSet, baseline.someUnorderedSet, makeJsonMemberName("someUnorderedSet", "\"someUnorderedSet\""),
+        value, allocator);
+    pushDelta(reflectable.someUnorderedMultiset, baseline.someUnorderedMultiset,
+        makeJsonMemberName("someUnorderedMultiset", "\"someUnorderedMultiset\""), value, allocator);
+    pushDelta(reflectable.someVariant, baseline.someVariant, makeJsonMemberName("someVariant", "\"someVariant\""), value, allocator);
+    pushDelta(reflectable.anotherVariant, baseline.anotherVariant, makeJsonMemberName("anotherVariant", "\"anotherVariant\""), value, allocator);
+    pushDelta(reflectable.yetAnotherVariant, baseline.yetAnotherVariant, makeJsonMemberName("yetAnotherVariant", "\"yetAnotherVariant\""),
+        value, allocator);
+}
+
+template <>
+inline void pushDelta<NestingObject>(const NestingObject &reflectable, const NestingObject &baseline, Value::Object &value,
+    Document::AllocatorType &allocator)
+{
+    pushDelta(reflectable.name, baseline.name, makeJsonMemberName("name", "\"name\""), value, allocator);
+    pushDelta(reflectable.testObj, baseline.testObj, makeJsonMemberName("testObj", "\"testObj\""), value, allocator);
+}
+
+template <>
+inline void pushDelta<NestingArray>(const NestingArray &reflectable, const NestingArray &baseline, Value::Object &value,
+    Document::AllocatorType &allocator)
+{
+    pushDelta(reflectable.name, baseline.name, makeJsonMemberName("name", "\"name\""), value, allocator);
+    pushDelta(reflectable.testObjects, baseline.testObjects, makeJsonMemberName("testObjects", "\"testObjects\""), value, allocator);
+}
+
 template <>
 inline void pull<TestObject>(TestObject &reflectable, const GenericValue<UTF8<char>>::ConstObject &value, JsonDeserializationErrors *errors)
 {
@@ -168,6 +277,292 @@ inline void pull<NestingArray>(NestingArray &reflectable, const GenericValue<UTF
     }
 }
 
+template <> struct JsonMembers<TestObject> {
+    template <typename Writer> static void writeMembers(const TestObject &reflectable, Writer &writer)
+    {
+        write(reflectable.number, "number", writer);
+        write(reflectable.number2, "number2", writer);
+        write(reflectable.numbers, "numbers", writer);
+        write(reflectable.text, "text", writer);
+        write(reflectable.boolean, "boolean", writer);
+        write(reflectable.someMap, "someMap", writer);
+        write(reflectable.someHash, "someHash", writer);
+        write(reflectable.someMultimap, "someMultimap", writer);
+        write(reflectable.someMultiHash, "someMultiHash", writer);
+        write(reflectable.someSet, "someSet", writer);
+        write(reflectable.someMultiset, "someMultiset", writer);
+        write(reflectable.someUnorderedSet, "someUnorderedSet", writer);
+        write(reflectable.someUnorderedMultiset, "someUnorderedMultiset", writer);
+        write(reflectable.someVariant, "someVariant", writer);
+        write(reflectable.anotherVariant, "anotherVariant", writer);
+        write(reflectable.yetAnotherVariant, "yetAnotherVariant", writer);
+    }
+
+    template <typename Writer> static void writeMembersWithoutDefaults(const TestObject &reflectable, const TestObject &defaults, Writer &writer)
+    {
+        writeWithoutDefault(reflectable.number, defaults.number, "number", writer);
+        writeWithoutDefault(reflectable.number2, defaults.number2, "number2", writer);
+        writeWithoutDefault(reflectable.numbers, defaults.numbers, "numbers", writer);
+        writeWithoutDefault(reflectable.text, defaults.text, "text", writer);
+        writeWithoutDefault(reflectable.boolean, defaults.boolean, "boolean", writer);
+        writeWithoutDefault(reflectable.someMap, defaults.someMap, "someMap", writer);
+        writeWithoutDefault(reflectable.someHash, defaults.someHash, "someHash", writer);
+        writeWithoutDefault(reflectable.someMultimap, defaults.someMultimap, "someMultimap", writer);
+        writeWithoutDefault(reflectable.someMultiHash, defaults.someMultiHash, "someMultiHash", writer);
+        writeWithoutDefault(reflectable.someSet, defaults.someSet, "someSet", writer);
+        writeWithoutDefault(reflectable.someMultiset, defaults.someMultiset, "someMultiset", writer);
+        writeWithoutDefault(reflectable.someUnorderedSet, defaults.someUnorderedSet, "someUnorderedSet", writer);
+        writeWithoutDefault(reflectable.someUnorderedMultiset, defaults.someUnorderedMultiset, "someUnorderedMultiset", writer);
+        writeWithoutDefault(reflectable.someVariant, defaults.someVariant, "someVariant", writer);
+        writeWithoutDefault(reflectable.anotherVariant, defaults.anotherVariant, "anotherVariant", writer);
+        writeWithoutDefault(reflectable.yetAnotherVariant, defaults.yetAnotherVariant, "yetAnotherVariant", writer);
+    }
+
+    template <typename Reader>
+    static bool readMember(TestObject &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestObject";
+            }
+        }
+        auto found = true;
+        if (name == "number") {
+            read(reflectable.number, "number", reader, errors);
+        } else if (name == "number2") {
+            read(reflectable.number2, "number2", reader, errors);
+        } else if (name == "numbers") {
+            read(reflectable.numbers, "numbers", reader, errors);
+        } else if (name == "text") {
+            read(reflectable.text, "text", reader, errors);
+        } else if (name == "boolean") {
+            read(reflectable.boolean, "boolean", reader, errors);
+        } else if (name == "someMap") {
+            read(reflectable.someMap, "someMap", reader, errors);
+        } else if (name == "someHash") {
+            read(reflectable.someHash, "someHash", reader, errors);
+        } else if (name == "someMultimap") {
+            read(reflectable.someMultimap, "someMultimap", reader, errors);
+        } else if (name == "someMultiHash") {
+            read(reflectable.someMultiHash, "someMultiHash", reader, errors);
+        } else if (name == "someSet") {
+            read(reflectable.someSet, "someSet", reader, errors);
+        } else if (name == "someMultiset") {
+            read(reflectable.someMultiset, "someMultiset", reader, errors);
+        } else if (name == "someUnorderedSet") {
+            read(reflectable.someUnorderedSet, "someUnorderedSet", reader, errors);
+        } else if (name == "someUnorderedMultiset") {
+            read(reflectable.someUnorderedMultiset, "someUnorderedMultiset", reader, errors);
+        } else if (name == "someVariant") {
+            read(reflectable.someVariant, "someVariant", reader, errors);
+        } else if (name == "anotherVariant") {
+            read(reflectable.anotherVariant, "anotherVariant", reader, errors);
+        } else if (name == "yetAnotherVariant") {
+            read(reflectable.yetAnotherVariant, "yetAnotherVariant", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(TestObject &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "TestObject";
+            }
+        }
+        auto found = true;
+        if (name == "number") {
+            mergePatch(reflectable.number, "number", reader, errors);
+        } else if (name == "number2") {
+            mergePatch(reflectable.number2, "number2", reader, errors);
+        } else if (name == "numbers") {
+            mergePatch(reflectable.numbers, "numbers", reader, errors);
+        } else if (name == "text") {
+            mergePatch(reflectable.text, "text", reader, errors);
+        } else if (name == "boolean") {
+            mergePatch(reflectable.boolean, "boolean", reader, errors);
+        } else if (name == "someMap") {
+            mergePatch(reflectable.someMap, "someMap", reader, errors);
+        } else if (name == "someHash") {
+            mergePatch(reflectable.someHash, "someHash", reader, errors);
+        } else if (name == "someMultimap") {
+            mergePatch(reflectable.someMultimap, "someMultimap", reader, errors);
+        } else if (name == "someMultiHash") {
+            mergePatch(reflectable.someMultiHash, "someMultiHash", reader, errors);
+        } else if (name == "someSet") {
+            mergePatch(reflectable.someSet, "someSet", reader, errors);
+        } else if (name == "someMultiset") {
+            mergePatch(reflectable.someMultiset, "someMultiset", reader, errors);
+        } else if (name == "someUnorderedSet") {
+            mergePatch(reflectable.someUnorderedSet, "someUnorderedSet", reader, errors);
+        } else if (name == "someUnorderedMultiset") {
+            mergePatch(reflectable.someUnorderedMultiset, "someUnorderedMultiset", reader, errors);
+        } else if (name == "someVariant") {
+            mergePatch(reflectable.someVariant, "someVariant", reader, errors);
+        } else if (name == "anotherVariant") {
+            mergePatch(reflectable.anotherVariant, "anotherVariant", reader, errors);
+        } else if (name == "yetAnotherVariant") {
+            mergePatch(reflectable.yetAnotherVariant, "yetAnotherVariant", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+};
+template <> struct HasJsonMembers<TestObject> : public Traits::Bool<true> {};
+
+template <> struct JsonMembers<NestingObject> {
+    template <typename Writer> static void writeMembers(const NestingObject &reflectable, Writer &writer)
+    {
+        write(reflectable.name, makeJsonMemberName("name", "\"name\""), writer);
+        write(reflectable.testObj, makeJsonMemberName("testObj", "\"testObj\""), writer);
+    }
+
+    template <typename Writer>
+    static void writeMembersWithoutDefaults(const NestingObject &reflectable, const NestingObject &defaults, Writer &writer)
+    {
+        writeWithoutDefault(reflectable.name, defaults.name, makeJsonMemberName("name", "\"name\""), writer);
+        writeWithoutDefault(reflectable.testObj, defaults.testObj, makeJsonMemberName("testObj", "\"testObj\""), writer);
+    }
+
+    template <typename Reader>
+    static bool readMember(NestingObject &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "NestingObject";
+            }
+        }
+        auto found = true;
+        if (name == "name") {
+            read(reflectable.name, "name", reader, errors);
+        } else if (name == "testObj") {
+            read(reflectable.testObj, "testObj", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(NestingObject &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "NestingObject";
+            }
+        }
+        auto found = true;
+        if (name == "name") {
+            mergePatch(reflectable.name, "name", reader, errors);
+        } else if (name == "testObj") {
+            mergePatch(reflectable.testObj, "testObj", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+};
+template <> struct HasJsonMembers<NestingObject> : public Traits::Bool<true> {};
+
+template <> struct JsonMembers<NestingArray> {
+    template <typename Writer> static void writeMembers(const NestingArray &reflectable, Writer &writer)
+    {
+        write(reflectable.name, makeJsonMemberName("name", "\"name\""), writer);
+        write(reflectable.testObjects, makeJsonMemberName("testObjects", "\"testObjects\""), writer);
+    }
+
+    template <typename Writer> static void writeMembersWithoutDefaults(const NestingArray &reflectable, const NestingArray &defaults, Writer &writer)
+    {
+        writeWithoutDefault(reflectable.name, defaults.name, makeJsonMemberName("name", "\"name\""), writer);
+        writeWithoutDefault(reflectable.testObjects, defaults.testObjects, makeJsonMemberName("testObjects", "\"testObjects\""), writer);
+    }
+
+    template <typename Reader>
+    static bool readMember(NestingArray &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "NestingArray";
+            }
+        }
+        auto found = true;
+        if (name == "name") {
+            read(reflectable.name, "name", reader, errors);
+        } else if (name == "testObjects") {
+            read(reflectable.testObjects, "testObjects", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+
+    template <typename Reader>
+    static bool mergePatchMember(NestingArray &reflectable, std::string_view name, Reader &reader, JsonDeserializationErrors *errors)
+    {
+        const char *previousRecord;
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                previousRecord = errors->currentRecord;
+                errors->currentRecord = "NestingArray";
+            }
+        }
+        auto found = true;
+        if (name == "name") {
+            mergePatch(reflectable.name, "name", reader, errors);
+        } else if (name == "testObjects") {
+            mergePatch(reflectable.testObjects, "testObjects", reader, errors);
+        } else {
+            found = false;
+        }
+        if constexpr (Reader::tracksErrorContext) {
+            if (errors) {
+                errors->currentRecord = previousRecord;
+            }
+        }
+        return found;
+    }
+};
+template <> struct HasJsonMembers<NestingArray> : public Traits::Bool<true> {};
+
 } // namespace JsonReflector
 
 // namespace JsonReflector
@@ -183,16 +578,32 @@ class JsonReflectorTests : public TestFixture {
     CPPUNIT_TEST_SUITE(JsonReflectorTests);
     CPPUNIT_TEST(testSerializePrimitives);
     CPPUNIT_TEST(testSerializeSimpleObjects);
+    CPPUNIT_TEST(testSerializeIntoStreams);
+    CPPUNIT_TEST(testSerializeJsonLines);
+    CPPUNIT_TEST(testSerializeDelta);
     CPPUNIT_TEST(testSerializeNestedObjects);
     CPPUNIT_TEST(testSerializeUniquePtr);
     CPPUNIT_TEST(testSerializeSharedPtr);
+    CPPUNIT_TEST(testSerializeOptional);
     CPPUNIT_TEST(testDeserializePrimitives);
     CPPUNIT_TEST(testDeserializeSimpleObjects);
     CPPUNIT_TEST(testDeserializeNestedObjects);
     CPPUNIT_TEST(testDeserializeUniquePtr);
     CPPUNIT_TEST(testDeserializeSharedPtr);
+    CPPUNIT_TEST(testDeserializeOptional);
+    CPPUNIT_TEST(testDeserializeWithoutDocument);
+    CPPUNIT_TEST(testDeserializeInsitu);
+    CPPUNIT_TEST(testReusingContext);
+    CPPUNIT_TEST(testDeserializeJsonLines);
+    CPPUNIT_TEST(testDeserializeParallel);
+    CPPUNIT_TEST(testDeserializeProjection);
+    CPPUNIT_TEST(testMergePatch);
+    CPPUNIT_TEST(testPolicies);
+    CPPUNIT_TEST(testEnumsByName);
+    CPPUNIT_TEST(testMapsWithNonStringKeys);
     CPPUNIT_TEST(testHandlingParseError);
     CPPUNIT_TEST(testHandlingTypeMismatch);
+    CPPUNIT_TEST(testErrorModes);
     CPPUNIT_TEST_SUITE_END();
 
 public:
@@ -202,16 +613,32 @@ public:
     void experiment();
     void testSerializePrimitives();
     void testSerializeSimpleObjects();
+    void testSerializeIntoStreams();
+    void testSerializeJsonLines();
+    void testSerializeDelta();
     void testSerializeNestedObjects();
     void testSerializeUniquePtr();
     void testSerializeSharedPtr();
+    void testSerializeOptional();
     void testDeserializePrimitives();
     void testDeserializeSimpleObjects();
     void testDeserializeNestedObjects();
     void testDeserializeUniquePtr();
     void testDeserializeSharedPtr();
+    void testDeserializeOptional();
+    void testDeserializeWithoutDocument();
+    void testDeserializeInsitu();
+    void testReusingContext();
+    void testDeserializeJsonLines();
+    void testDeserializeParallel();
+    void testDeserializeProjection();
+    void testMergePatch();
+    void testPolicies();
+    void testEnumsByName();
+    void testMapsWithNonStringKeys();
     void testHandlingParseError();
     void testHandlingTypeMismatch();
+    void testErrorModes();
 
 private:
 };
@@ -261,6 +688,27 @@ void JsonReflectorTests::testSerializePrimitives()
     doc.Accept(jsonWriter);
     CPPUNIT_ASSERT_EQUAL("[\"foo\",\"bar\",25,12.5,1,1,2,[\"foo1\",\"bar1\"],[\"foo2\",\"bar2\"],[\"foo3\",\"bar3\"],[2,413.0],true,false]"s,
         string(strbuf.GetString()));
+
+    // write the same values directly without building a document first
+    StringBuffer directStrbuf;
+    JsonReflector::JsonStringBufferOutputStream directStream(directStrbuf);
+    JsonReflector::JsonWriter directWriter(directStream);
+    directWriter.StartArray();
+    JsonReflector::write<string>(foo, directWriter);
+    JsonReflector::write<const char *>("bar", directWriter);
+    JsonReflector::write<int>(25, directWriter);
+    JsonReflector::write<double>(12.5, directWriter);
+    JsonReflector::write<SomeEnum>(SomeEnumItem2, directWriter);
+    JsonReflector::write<SomeEnumClass>(SomeEnumClass::Item2, directWriter);
+    JsonReflector::write<SomeEnumClass>(SomeEnumClass::Item3, directWriter);
+    JsonReflector::write<vector<const char *>>({ "foo1", "bar1" }, directWriter);
+    JsonReflector::write<list<const char *>>({ "foo2", "bar2" }, directWriter);
+    JsonReflector::write<initializer_list<const char *>>({ "foo3", "bar3" }, directWriter);
+    JsonReflector::write<tuple<int, double>>(make_tuple(2, 413.0), directWriter);
+    JsonReflector::write<bool>(true, directWriter);
+    JsonReflector::write<bool>(false, directWriter);
+    directWriter.EndArray();
+    CPPUNIT_ASSERT_EQUAL(string(strbuf.GetString()), string(directStrbuf.GetString()));
 }
 
 /*!
@@ -288,6 +736,171 @@ void JsonReflectorTests::testSerializeSimpleObjects()
     CPPUNIT_ASSERT_EQUAL(
         "{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false,\"someMap\":{\"a\":1,\"b\":2},\"someHash\":{\"d\":false,\"c\":true},\"someMultimap\":{\"a\":[1,2],\"b\":[3]},\"someMultiHash\":{\"a\":[1]},\"someSet\":[\"a\",\"b\",\"c\"],\"someMultiset\":[\"a\",\"b\",\"b\"],\"someUnorderedSet\":[\"a\"],\"someUnorderedMultiset\":[\"b\",\"b\",\"b\"],\"someVariant\":{\"index\":0,\"data\":null},\"anotherVariant\":{\"index\":0,\"data\":\"foo\"},\"yetAnotherVariant\":{\"index\":1,\"data\":42}}"s,
         string(testObj.toJson().GetString()));
+    auto doc(testObj.toJsonDocument());
+    CPPUNIT_ASSERT_EQUAL_MESSAGE("writing directly yields same JSON as serializing document",
+        string(JsonReflector::serializeJsonDocToString(doc).GetString()), string(testObj.toJson().GetString()));
+
+    // equivalent keys of unordered multimaps end up within the same array
+    testObj.someMultiHash = { { "a", 1 }, { "a", 1 } };
+    auto multiHashDoc = JsonReflector::toJsonDocument(testObj.someMultiHash);
+    CPPUNIT_ASSERT_EQUAL("{\"a\":[1,1]}"s, string(JsonReflector::serializeJsonDocToString(multiHashDoc).GetString()));
+    CPPUNIT_ASSERT_EQUAL("{\"a\":[1,1]}"s, string(JsonReflector::toJson(testObj.someMultiHash).GetString()));
+
+    // custom types only providing push() are written via an intermediate value
+    CPPUNIT_ASSERT_EQUAL("[\"#1\",\"#2\"]"s, string(JsonReflector::toJson(vector<CustomObject>{ { 1 }, { 2 } }).GetString()));
+}
+
+/*!
+ * \brief Tests serializing directly into std::string, std::ostream and other RapidJSON output streams.
+ */
+void JsonReflectorTests::testSerializeIntoStreams()
+{
+    NestingObject nestingObj;
+    nestingObj.name = "nesting";
+    nestingObj.testObj.number = 42;
+    nestingObj.testObj.text = "test";
+    const auto expectedJson = string(nestingObj.toJson().GetString());
+
+    // strings and string buffers are appended to
+    auto str = "prefix:"s;
+    nestingObj.toJson(str);
+    CPPUNIT_ASSERT_EQUAL("prefix:" + expectedJson, str);
+    str.clear();
+    nestingObj.toJson(str);
+    CPPUNIT_ASSERT_EQUAL(expectedJson, str);
+    RAPIDJSON_NAMESPACE::StringBuffer buffer;
+    JsonReflector::toJson(42, buffer);
+    JsonReflector::toJson(vector<int>{ 1, 2 }, buffer);
+    CPPUNIT_ASSERT_EQUAL("42[1,2]"s, string(buffer.GetString()));
+
+    // std::ostream
+    stringstream ss;
+    nestingObj.toJson(ss);
+    CPPUNIT_ASSERT_EQUAL(expectedJson, ss.str());
+
+    // other RapidJSON output streams; exceed the internal buffer to test forwarding in chunks
+    struct CollectingStream {
+        typedef char Ch;
+        void Put(Ch c)
+        {
+            collected += c;
+        }
+        void Flush()
+        {
+            ++flushCount;
+        }
+        string collected;
+        size_t flushCount = 0;
+    } collectingStream;
+    vector<int> numbers(3000, 12345);
+    JsonReflector::toJson(numbers, collectingStream);
+    CPPUNIT_ASSERT_EQUAL(string(JsonReflector::toJson(numbers).GetString()), collectingStream.collected);
+    CPPUNIT_ASSERT(collectingStream.flushCount > 1);
+    str.clear();
+    JsonReflector::toJson(numbers, str);
+    CPPUNIT_ASSERT_EQUAL(collectingStream.collected, str);
+}
+
+/*!
+ * \brief Tests serializing containers as newline-delimited JSON using multiple threads.
+ */
+void JsonReflectorTests::testSerializeJsonLines()
+{
+    vector<NestingObject> objects(1001);
+    string expectedLines;
+    for (auto &object : objects) {
+        const auto index = static_cast<int>(&object - objects.data());
+        object.name = "object" + to_string(index);
+        object.testObj.number = index;
+        expectedLines += object.toJson().GetString();
+        expectedLines += '\n';
+    }
+    for (const size_t threadCount : { 0, 1, 2, 3, 8, 2000 }) {
+        CPPUNIT_ASSERT_EQUAL_MESSAGE("thread count " + to_string(threadCount), expectedLines, JsonReflector::toJsonLines(objects, threadCount));
+    }
+
+    // existing content is kept; works with non-random-access containers
+    auto lines = "prefix\n"s;
+    JsonReflector::toJsonLines(list<vector<int>>{ { 1 }, {}, { 2, 3 } }, lines, 2);
+    CPPUNIT_ASSERT_EQUAL("prefix\n[1]\n[]\n[2,3]\n"s, lines);
+    CPPUNIT_ASSERT_EQUAL(string(), JsonReflector::toJsonLines(vector<int>(), 4));
+}
+
+/*!
+ * \brief Tests serializing only the members differing from a baseline via toJsonDelta().
+ */
+void JsonReflectorTests::testSerializeDelta()
+{
+    auto baseline = NestingObject();
+    baseline.name = "nesting";
+    baseline.testObj.number = 42;
+    baseline.testObj.numbers = { 1, 2, 3 };
+    baseline.testObj.text = "test";
+    baseline.testObj.someMap = { { "a", 1 }, { "b", 2 } };
+    CPPUNIT_ASSERT_EQUAL("{}"s, string(JsonReflector::toJsonDelta(baseline, baseline).GetString()));
+
+    // only changed members are emitted, arrays as a whole and removed map keys as null
+    auto current = baseline;
+    current.testObj.number = 43;
+    current.testObj.numbers.emplace_back(4);
+    current.testObj.someMap.erase("a");
+    current.testObj.someMap["c"] = 3;
+    const auto delta = current.toJsonDelta(baseline);
+    CPPUNIT_ASSERT_EQUAL("{\"testObj\":{\"number\":43,\"numbers\":[1,2,3,4],\"someMap\":{\"c\":3,\"a\":null}}}"s, string(delta.GetString()));
+
+    // applying the delta as merge patch to the baseline yields the current state
+    auto patched = baseline;
+    patched.applyMergePatch(delta.GetString(), delta.GetSize());
+    CPPUNIT_ASSERT_EQUAL(string(current.toJson().GetString()), string(patched.toJson().GetString()));
+
+    // multimaps are emitted and replaced as a whole so applying the delta does not duplicate their entries
+    auto multimapBaseline = baseline;
+    multimapBaseline.testObj.someMultimap = { { "a", 1 }, { "a", 2 }, { "b", 3 } };
+    auto multimapCurrent = multimapBaseline;
+    multimapCurrent.testObj.someMultimap.erase("b");
+    multimapCurrent.testObj.someMultimap.emplace("a", 3);
+    const auto multimapDelta = multimapCurrent.toJsonDelta(multimapBaseline);
+    CPPUNIT_ASSERT_EQUAL("{\"testObj\":{\"someMultimap\":{\"a\":[1,2,3]}}}"s, string(multimapDelta.GetString()));
+    auto patchedMultimap = multimapBaseline;
+    patchedMultimap.applyMergePatch(multimapDelta.GetString(), multimapDelta.GetSize());
+    CPPUNIT_ASSERT_EQUAL(multimapCurrent.testObj.someMultimap, patchedMultimap.testObj.someMultimap);
+    CPPUNIT_ASSERT_EQUAL(string(multimapCurrent.toJson().GetString()), string(patchedMultimap.toJson().GetString()));
+
+    // members equal to their default value are omitted and restored when deserializing
+    const auto withoutDefaults = current.toJsonWithoutDefaults();
+    CPPUNIT_ASSERT_EQUAL("{\"name\":\"nesting\",\"testObj\":{\"number\":43,\"numbers\":[1,2,3,4],\"text\":\"test\",\"someMap\":{\"b\":2,\"c\":3}}}"s,
+        string(withoutDefaults.GetString()));
+    CPPUNIT_ASSERT_EQUAL(string(current.toJson().GetString()), string(NestingObject::fromJson(withoutDefaults.GetString()).toJson().GetString()));
+
+    // nested objects equal to their default value are omitted as well (even without operator==); maps are written as a whole
+    // and no null is emitted
+    CPPUNIT_ASSERT_EQUAL("{}"s, string(NestingObject().toJsonWithoutDefaults().GetString()));
+    auto sparse = NestingObject();
+    sparse.testObj.someMap = { { "a", 1 } };
+    CPPUNIT_ASSERT_EQUAL("{\"testObj\":{\"someMap\":{\"a\":1}}}"s, string(sparse.toJsonWithoutDefaults().GetString()));
+
+    // unordered containers holding the same elements are equal regardless of their iteration order
+    auto reordered = baseline;
+    baseline.testObj.someUnorderedSet = { "a", "b", "c", "d" };
+    baseline.testObj.someMultiHash = { { "a", 1 }, { "a", 2 }, { "b", 3 } };
+    reordered.testObj.someUnorderedSet.reserve(64);
+    reordered.testObj.someUnorderedSet.insert({ "d", "c", "b", "a" });
+    reordered.testObj.someMultiHash = { { "b", 3 }, { "a", 2 }, { "a", 1 } };
+    CPPUNIT_ASSERT_EQUAL("{}"s, string(reordered.toJsonDelta(baseline).GetString()));
+    reordered.testObj.someMultiHash.emplace("a", 1);
+    CPPUNIT_ASSERT(!JsonReflector::Detail::isEqualForDelta(reordered.testObj.someMultiHash, baseline.testObj.someMultiHash));
+    CPPUNIT_ASSERT("{}"s != reordered.toJsonDelta(baseline).GetString());
+
+    // pointers and optionals are compared by their pointees, containers and variants element-wise
+    auto pointers = vector<unique_ptr<string>>(), otherPointers = vector<unique_ptr<string>>();
+    pointers.emplace_back(make_unique<string>("foo"));
+    otherPointers.emplace_back(make_unique<string>("foo"));
+    CPPUNIT_ASSERT(JsonReflector::Detail::isEqualForDelta(pointers, otherPointers));
+    otherPointers.emplace_back();
+    CPPUNIT_ASSERT(!JsonReflector::Detail::isEqualForDelta(pointers, otherPointers));
+    CPPUNIT_ASSERT(JsonReflector::Detail::isEqualForDelta(optional<vector<int>>({ 1, 2 }), optional<vector<int>>({ 1, 2 })));
+    CPPUNIT_ASSERT(!JsonReflector::Detail::isEqualForDelta(optional<vector<int>>({ 1, 2 }), optional<vector<int>>()));
+    CPPUNIT_ASSERT((!JsonReflector::Detail::isEqualForDelta(variant<int, string>(1), variant<int, string>("1"s))));
 }
 
 /*!
@@ -379,6 +992,24 @@ void JsonReflectorTests::testSerializeSharedPtr()
         string(strbuf.GetString()));
 }
 
+void JsonReflectorTests::testSerializeOptional()
+{
+    Document doc(kArrayType);
+    Document::AllocatorType &alloc = doc.GetAllocator();
+    doc.SetArray();
+    Document::Array array(doc.GetArray());
+
+    const auto values = vector<optional<string>>{ "foo", nullopt };
+    JsonReflector::push(values, array, alloc);
+    JsonReflector::push(optional<int>(42), array, alloc);
+
+    StringBuffer strbuf;
+    Writer<StringBuffer> jsonWriter(strbuf);
+    doc.Accept(jsonWriter);
+    CPPUNIT_ASSERT_EQUAL("[[\"foo\",null],42]"s, string(strbuf.GetString()));
+    CPPUNIT_ASSERT_EQUAL("[\"foo\",null]"s, string(JsonReflector::toJson(values).GetString()));
+}
+
 /*!
  * \brief Tests deserializing strings, numbers (int, float, double) and boolean.
  */
@@ -470,6 +1101,20 @@ void JsonReflectorTests::testDeserializeSimpleObjects()
     CPPUNIT_ASSERT_EQUAL("foo"s, std::get<0>(testObj.anotherVariant));
     CPPUNIT_ASSERT_EQUAL(1_st, testObj.yetAnotherVariant.index());
     CPPUNIT_ASSERT_EQUAL(42, std::get<1>(testObj.yetAnotherVariant));
+
+    // existing maps are updated; keys are taken with their length (so they might contain null characters)
+    Document doc;
+    doc.Parse("{\"a\":3,\"c\\u0000d\":4}");
+    map<string, int, less<>> transparentMap{ { "a", 1 }, { "b", 2 } };
+    unordered_map<string, int> hash{ { "a", 1 } };
+    JsonDeserializationErrors errors;
+    JsonReflector::pull(transparentMap, doc, &errors);
+    JsonReflector::pull(hash, doc, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    const map<string, int, less<>> expectedTransparentMap{ { "a", 3 }, { "b", 2 }, { string("c\0d", 3), 4 } };
+    CPPUNIT_ASSERT_EQUAL(expectedTransparentMap, transparentMap);
+    const unordered_map<string, int> expectedHashAfterPull{ { "a", 3 }, { string("c\0d", 3), 4 } };
+    CPPUNIT_ASSERT_EQUAL(expectedHashAfterPull, hash);
 }
 
 /*!
@@ -561,6 +1206,578 @@ void JsonReflectorTests::testDeserializeSharedPtr()
     CPPUNIT_ASSERT_EQUAL("bar"s, obj->text);
 }
 
+void JsonReflectorTests::testDeserializeOptional()
+{
+    Document doc(kArrayType);
+    doc.Parse("[\"foo\",null]");
+    auto array = doc.GetArray().begin();
+
+    optional<string> str;
+    optional<string> nullStr("bar");
+    JsonDeserializationErrors errors;
+    JsonReflector::pull(str, array, &errors);
+    JsonReflector::pull(nullStr, array, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT(str.has_value());
+    CPPUNIT_ASSERT_EQUAL("foo"s, *str);
+    CPPUNIT_ASSERT(!nullStr.has_value());
+
+    const auto values = JsonReflector::fromJson<vector<optional<int>>>("[1,null,\"3\"]"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(3_st, values.size());
+    CPPUNIT_ASSERT(values[0] == 1);
+    CPPUNIT_ASSERT(!values[1].has_value());
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors.front().kind);
+}
+
+/*!
+ * \brief Tests deserializing via fromJsonSax() which populates the objects while parsing without building a document.
+ */
+void JsonReflectorTests::testDeserializeWithoutDocument()
+{
+    JsonDeserializationErrors errors;
+    const auto testObj
+        = TestObject::fromJsonSax("{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"unknown\":{\"a\":[1,{}]},\"text\":\"test\","
+                                  "\"boolean\":false,\"someMap\":{\"a\":1,\"b\":2},\"someHash\":{\"c\":true,\"d\":false},\"someMultimap\":{\"a\":[1,"
+                                  "2],\"b\":3},\"someMultiHash\":{\"a\":[4,5],\"b\":[6]},\"someSet\":[\"a\",\"b\"],\"someMultiset\":[\"a\",\"a\"],"
+                                  "\"someUnorderedSet\":[\"a\",\"b\"],\"someUnorderedMultiset\":[\"a\",\"a\"],\"someVariant\":{\"index\":0,\"data\":"
+                                  "null},\"anotherVariant\":{\"data\":\"foo\",\"index\":0},\"yetAnotherVariant\":{\"index\":1,\"data\":42}}",
+            &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(42, testObj.number);
+    CPPUNIT_ASSERT_EQUAL(3.141592653589793, testObj.number2);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2, 3, 4 }), testObj.numbers);
+    CPPUNIT_ASSERT_EQUAL("test"s, testObj.text);
+    CPPUNIT_ASSERT_EQUAL(false, testObj.boolean);
+    const map<string, int> expectedMap{ { "a", 1 }, { "b", 2 } };
+    CPPUNIT_ASSERT_EQUAL(expectedMap, testObj.someMap);
+    const unordered_map<string, bool> expectedHash{ { "c", true }, { "d", false } };
+    CPPUNIT_ASSERT_EQUAL(expectedHash, testObj.someHash);
+    const multimap<string, int> expectedMultiMap{ { "a", 1 }, { "a", 2 }, { "b", 3 } };
+    CPPUNIT_ASSERT_EQUAL(expectedMultiMap, testObj.someMultimap);
+    const unordered_multimap<string, int> expectedUnorderedMultiMap{ { "a", 4 }, { "a", 5 }, { "b", 6 } };
+    CPPUNIT_ASSERT_EQUAL(expectedUnorderedMultiMap, testObj.someMultiHash);
+    CPPUNIT_ASSERT_EQUAL(set<string>({ "a", "b" }), testObj.someSet);
+    CPPUNIT_ASSERT_EQUAL(multiset<string>({ "a", "a" }), testObj.someMultiset);
+    CPPUNIT_ASSERT_EQUAL(unordered_set<string>({ "a", "b" }), testObj.someUnorderedSet);
+    CPPUNIT_ASSERT_EQUAL(unordered_multiset<string>({ "a", "a" }), testObj.someUnorderedMultiset);
+    CPPUNIT_ASSERT_EQUAL(0_st, testObj.someVariant.index());
+    CPPUNIT_ASSERT_EQUAL(0_st, testObj.anotherVariant.index());
+    CPPUNIT_ASSERT_EQUAL("foo"s, std::get<0>(testObj.anotherVariant));
+    CPPUNIT_ASSERT_EQUAL(1_st, testObj.yetAnotherVariant.index());
+    CPPUNIT_ASSERT_EQUAL(42, std::get<1>(testObj.yetAnotherVariant));
+
+    // round-trip nested objects and arrays
+    NestingArray nestingArray;
+    nestingArray.name = "nesting2";
+    nestingArray.testObjects.emplace_back(testObj);
+    nestingArray.testObjects.emplace_back(testObj);
+    nestingArray.testObjects.back().number = 43;
+    const auto json = nestingArray.toJson();
+    const auto parsedNestingArray = NestingArray::fromJsonSax(json.GetString(), json.GetSize(), &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(string(json.GetString()), string(parsedNestingArray.toJson().GetString()));
+    const auto parsedTuple = JsonReflector::fromJsonSax<tuple<int, string>>("[5,\"foo\"]", &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(5, get<0>(parsedTuple));
+    CPPUNIT_ASSERT_EQUAL("foo"s, get<1>(parsedTuple));
+
+    // errors are reported with the same context as by fromJson()
+    NestingArray::fromJsonSax("{\"name\":\"nesting2\",\"testObjects\":[25,{\"number\":42,\"number2\":3.141592653589793,"
+                              "\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false},\"foo\",{\"number\":43,\"number2\":3."
+                              "141592653589793,\"numbers\":[1,2,3,4,\"bar\"],\"text\":\"test\",\"boolean\":false}]}",
+        &errors);
+    CPPUNIT_ASSERT_EQUAL(3_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors[0].kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::Object, errors[0].expectedType);
+    CPPUNIT_ASSERT_EQUAL(JsonType::Number, errors[0].actualType);
+    CPPUNIT_ASSERT_EQUAL("testObjects"s, string(errors[0].member));
+    CPPUNIT_ASSERT_EQUAL("NestingArray"s, string(errors[0].record));
+    CPPUNIT_ASSERT_EQUAL(0_st, errors[0].index);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors[1].actualType);
+    CPPUNIT_ASSERT_EQUAL(2_st, errors[1].index);
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors[2].kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::Number, errors[2].expectedType);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors[2].actualType);
+    CPPUNIT_ASSERT_EQUAL("numbers"s, string(errors[2].member));
+    CPPUNIT_ASSERT_EQUAL("TestObject"s, string(errors[2].record));
+    CPPUNIT_ASSERT_EQUAL(4_st, errors[2].index);
+    errors.clear();
+
+    JsonReflector::fromJsonSax<tuple<int, string>>("[5,\"foo\",3]", &errors);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ArraySizeMismatch, errors.front().kind);
+    errors.clear();
+
+    // custom types only providing pull() are pulled from an intermediate value
+    const auto customObjects = JsonReflector::fromJsonSax<vector<CustomObject>>("[\"#1\",\"2\",\"#3\"]", &errors);
+    CPPUNIT_ASSERT_EQUAL(3_st, customObjects.size());
+    CPPUNIT_ASSERT_EQUAL(1, customObjects[0].number);
+    CPPUNIT_ASSERT_EQUAL(3, customObjects[2].number);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.front().index);
+    errors.clear();
+    auto customObjectsByName = map<string, CustomObject>{ { "a", { 1 } }, { "b", { 2 } } };
+    JsonReflector::applyMergePatch(customObjectsByName, "{\"a\":\"#4\",\"b\":null}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(1_st, customObjectsByName.size());
+    CPPUNIT_ASSERT_EQUAL(4, customObjectsByName.at("a").number);
+
+    // invalid JSON leads to ParseResult being thrown like with fromJson()
+    try {
+        NestingObject::fromJsonSax("{\"name\":nesting\",\"testObj\":{}}");
+        CPPUNIT_FAIL("expected ParseResult thrown");
+    } catch (const RAPIDJSON_NAMESPACE::ParseResult &res) {
+        CPPUNIT_ASSERT_EQUAL(RAPIDJSON_NAMESPACE::kParseErrorValueInvalid, res.Code());
+        CPPUNIT_ASSERT_EQUAL(9_st, res.Offset());
+    }
+
+    // content following the root value is not ignored; trailing whitespace is fine
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2 }), JsonReflector::fromJsonSax<vector<int>>("[1,2] \n"));
+    for (const auto *const json : { "[1,2] x", "[1,2][3]", "1 2" }) {
+        try {
+            JsonReflector::fromJsonSax<vector<int>>(json);
+            CPPUNIT_FAIL("expected ParseResult thrown");
+        } catch (const RAPIDJSON_NAMESPACE::ParseResult &res) {
+            CPPUNIT_ASSERT_EQUAL(RAPIDJSON_NAMESPACE::kParseErrorDocumentRootNotSingular, res.Code());
+        }
+    }
+}
+
+/*!
+ * \brief Tests deserializing via fromJsonInsitu() which lets std::string_view and const char * point into the buffer.
+ */
+void JsonReflectorTests::testDeserializeInsitu()
+{
+    JsonDeserializationErrors errors;
+    char buffer[] = "[\"fo\\no\",\"bar\",\"b\\u00e4z\",5,[\"a\",\"bc\"]]trailing";
+    const auto bufferSize = sizeof(buffer) - sizeof("trailing");
+    const auto parsedTuple
+        = JsonReflector::fromJsonInsitu<tuple<std::string_view, const char *, string, int, vector<std::string_view>>>(buffer, bufferSize, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL("fo\no"s, string(get<0>(parsedTuple)));
+    CPPUNIT_ASSERT_EQUAL("bar"s, string(get<1>(parsedTuple)));
+    CPPUNIT_ASSERT_EQUAL("b\xc3\xa4z"s, get<2>(parsedTuple));
+    CPPUNIT_ASSERT_EQUAL(5, get<3>(parsedTuple));
+    CPPUNIT_ASSERT_EQUAL(2_st, get<4>(parsedTuple).size());
+    CPPUNIT_ASSERT_EQUAL("a"s, string(get<4>(parsedTuple)[0]));
+    CPPUNIT_ASSERT_EQUAL("bc"s, string(get<4>(parsedTuple)[1]));
+    // views point into the buffer which is not read beyond the specified size
+    CPPUNIT_ASSERT(get<0>(parsedTuple).data() > buffer && get<0>(parsedTuple).data() < buffer + bufferSize);
+    CPPUNIT_ASSERT(get<1>(parsedTuple) > buffer && get<1>(parsedTuple) < buffer + bufferSize);
+    CPPUNIT_ASSERT_EQUAL("trailing"s, string(buffer + bufferSize));
+
+    // std::string members are populated as usual; errors are reported like by fromJsonSax()
+    auto json = "{\"name\":\"nesting\",\"testObj\":{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,\"3\"],\"text\":\"test\","
+                "\"boolean\":false}}"s;
+    const auto nestingObj = NestingObject::fromJsonInsitu(json, &errors);
+    CPPUNIT_ASSERT_EQUAL("nesting"s, nestingObj.name);
+    CPPUNIT_ASSERT_EQUAL("test"s, nestingObj.testObj.text);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2, 0 }), nestingObj.testObj.numbers);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL(2_st, errors.front().index);
+    errors.clear();
+
+    // variant data preceding the index is buffered so views can not point into the buffer; this is reported as conversion error
+    auto variantJson = "[{\"data\":\"foo\",\"index\":1},{\"data\":\"bar\",\"index\":2},{\"index\":1,\"data\":\"baz\"}]"s;
+    const auto variants = JsonReflector::fromJsonInsitu<vector<variant<monostate, std::string_view, string>>>(variantJson, &errors);
+    CPPUNIT_ASSERT_EQUAL(3_st, variants.size());
+    CPPUNIT_ASSERT_EQUAL(0_st, variants[0].index());
+    CPPUNIT_ASSERT_EQUAL("bar"s, get<2>(variants[1]));
+    CPPUNIT_ASSERT_EQUAL("baz"s, string(get<1>(variants[2])));
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors.front().actualType);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.front().index);
+
+    // unterminated strings are detected at the end of the buffer
+    char unterminated[] = "[\"foo\"]";
+    try {
+        JsonReflector::fromJsonInsitu<vector<std::string_view>>(unterminated, 5);
+        CPPUNIT_FAIL("expected ParseResult thrown");
+    } catch (const RAPIDJSON_NAMESPACE::ParseResult &res) {
+        CPPUNIT_ASSERT_EQUAL(RAPIDJSON_NAMESPACE::kParseErrorStringMissQuotationMark, res.Code());
+    }
+
+    // content following the root value within the buffer is not ignored
+    char trailing[] = "[\"foo\"],";
+    CPPUNIT_ASSERT_THROW(JsonReflector::fromJsonInsitu<vector<std::string_view>>(trailing, sizeof(trailing) - 1), RAPIDJSON_NAMESPACE::ParseResult);
+}
+
+/*!
+ * \brief Tests (de)serializing multiple times reusing the same JsonReflector::Context.
+ */
+void JsonReflectorTests::testReusingContext()
+{
+    JsonReflector::Context context(256, 256);
+    JsonDeserializationErrors errors;
+    for (auto i = 0; i != 3; ++i) {
+        const auto json = "{\"name\":\"nesting" + to_string(i) + "\",\"testObj\":{\"number\":" + to_string(i)
+            + ",\"number2\":3.141592653589793,\"numbers\":[1,2,3,4],\"text\":\"test\",\"boolean\":false}}";
+        const auto nestingObj = NestingObject::fromJson(context, json, &errors);
+        CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+        CPPUNIT_ASSERT_EQUAL("nesting" + to_string(i), nestingObj.name);
+        CPPUNIT_ASSERT_EQUAL(i, nestingObj.testObj.number);
+        CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2, 3, 4 }), nestingObj.testObj.numbers);
+
+        // documents built within the context are the same as the regular ones
+        RAPIDJSON_NAMESPACE::StringBuffer buffer;
+        RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer> writer(buffer);
+        nestingObj.toJsonDocument(context).Accept(writer);
+        CPPUNIT_ASSERT_EQUAL(string(nestingObj.toJson().GetString()), string(buffer.GetString()));
+    }
+
+    // documents exceeding the buffers are supported as well
+    vector<int> numbers(1000);
+    for (auto &number : numbers) {
+        number = static_cast<int>(&number - numbers.data());
+    }
+    const auto numbersJson = JsonReflector::toJson(numbers);
+    CPPUNIT_ASSERT_EQUAL(numbers, JsonReflector::fromJson<vector<int>>(context, numbersJson.GetString(), numbersJson.GetSize(), &errors));
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+
+    // the context is still usable after a parsing error
+    CPPUNIT_ASSERT_THROW(JsonReflector::fromJson<vector<int>>(context, "[1,2"), RAPIDJSON_NAMESPACE::ParseResult);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2 }), JsonReflector::fromJson<vector<int>>(context, "[1,2]"));
+}
+
+/*!
+ * \brief Tests reading newline-delimited JSON via JsonReflector::JsonLinesReader.
+ */
+void JsonReflectorTests::testDeserializeJsonLines()
+{
+    vector<NestingObject> objects(3);
+    for (auto &object : objects) {
+        object.name = "object" + to_string(&object - objects.data());
+    }
+    stringstream lines(JsonReflector::toJsonLines(objects) + "\n  \r\n{\"name\":\"last\",\"testObj\":{\"number\":\"42\"}}");
+
+    // iterate over records
+    JsonDeserializationErrors errors;
+    JsonReflector::JsonLinesReader<NestingObject> reader(lines, &errors);
+    vector<string> names;
+    for (const auto &object : reader) {
+        names.emplace_back(object.name);
+    }
+    CPPUNIT_ASSERT_EQUAL(vector<string>({ "object0", "object1", "object2", "last" }), names);
+    CPPUNIT_ASSERT_EQUAL(6_st, reader.lineNumber());
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL("number"s, string(errors.front().member));
+
+    // read records one by one
+    stringstream invalidLines("[1,2]\n[3\n[4]");
+    JsonReflector::JsonLinesReader<vector<int>> vectorReader(invalidLines);
+    vector<int> record;
+    CPPUNIT_ASSERT(vectorReader.read(record));
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2 }), record);
+    CPPUNIT_ASSERT_THROW(vectorReader.read(record), RAPIDJSON_NAMESPACE::ParseResult);
+    CPPUNIT_ASSERT_EQUAL(2_st, vectorReader.lineNumber());
+    CPPUNIT_ASSERT(vectorReader.read(record));
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 4 }), record);
+    CPPUNIT_ASSERT(!vectorReader.read(record));
+}
+
+/*!
+ * \brief Tests deserializing top-level arrays via fromJsonParallel() which pulls the elements using multiple threads.
+ */
+void JsonReflectorTests::testDeserializeParallel()
+{
+    string json("[");
+    for (auto i = 0; i != 1000; ++i) {
+        json += i ? "," : "";
+        json += "{\"name\":\"object" + to_string(i) + "\",\"testObj\":{\"number\":" + (i % 300 == 5 ? "\"x\"" : to_string(i)) + "}}";
+    }
+    json += "]";
+
+    JsonDeserializationErrors serialErrors;
+    const auto serialObjects = JsonReflector::fromJson<vector<NestingObject>>(json, &serialErrors);
+    CPPUNIT_ASSERT_EQUAL(1000_st, serialObjects.size());
+    CPPUNIT_ASSERT_EQUAL(4_st, serialErrors.size());
+    for (const size_t threadCount : { 0, 1, 3, 8, 2000 }) {
+        JsonDeserializationErrors errors;
+        const auto objects = JsonReflector::fromJsonParallel<vector<NestingObject>>(json.data(), json.size(), &errors, threadCount);
+        CPPUNIT_ASSERT_EQUAL(serialObjects.size(), objects.size());
+        for (size_t i = 0; i != objects.size(); ++i) {
+            CPPUNIT_ASSERT_EQUAL(serialObjects[i].name, objects[i].name);
+            CPPUNIT_ASSERT_EQUAL(serialObjects[i].testObj.number, objects[i].testObj.number);
+        }
+        CPPUNIT_ASSERT_EQUAL(serialErrors.size(), errors.size());
+        for (size_t i = 0; i != errors.size(); ++i) {
+            CPPUNIT_ASSERT_EQUAL(serialErrors[i].kind, errors[i].kind);
+            CPPUNIT_ASSERT_EQUAL(serialErrors[i].index, errors[i].index);
+            CPPUNIT_ASSERT_EQUAL(string(serialErrors[i].record), string(errors[i].record));
+            CPPUNIT_ASSERT_EQUAL(string(serialErrors[i].member), string(errors[i].member));
+        }
+        CPPUNIT_ASSERT_EQUAL(JsonDeserializationError::noIndex, errors.currentIndex);
+    }
+    CPPUNIT_ASSERT_EQUAL(605_st, serialErrors[2].index);
+
+    // the first fatal error is thrown
+    JsonDeserializationErrors errors;
+    errors.throwOn = JsonDeserializationErrors::ThrowOn::TypeMismatch;
+    try {
+        JsonReflector::fromJsonParallel<vector<NestingObject>>(json.data(), json.size(), &errors, 4);
+        CPPUNIT_FAIL("expected JsonDeserializationError thrown");
+    } catch (const JsonDeserializationError &error) {
+        CPPUNIT_ASSERT_EQUAL(5_st, error.index);
+        CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    }
+}
+
+/*!
+ * \brief Tests deserializing only the members contained by a JsonReflector::JsonFieldMask.
+ */
+void JsonReflectorTests::testDeserializeProjection()
+{
+    const auto json = "{\"number\":42,\"number2\":3.141592653589793,\"numbers\":[1,2,\"3\"],\"text\":\"test\",\"boolean\":true,"
+                      "\"someMap\":{\"a\":\"b\"},\"someVariant\":{\"index\":0,\"data\":null}}"s;
+    JsonDeserializationErrors errors;
+    const auto testObj = TestObject::fromJson(json, { "number", "text", "unknown" }, &errors);
+    CPPUNIT_ASSERT_EQUAL(42, testObj.number);
+    CPPUNIT_ASSERT_EQUAL("test"s, testObj.text);
+    CPPUNIT_ASSERT_EQUAL(0.0, testObj.number2);
+    CPPUNIT_ASSERT_EQUAL(vector<int>(), testObj.numbers);
+    CPPUNIT_ASSERT_EQUAL(false, testObj.boolean);
+    CPPUNIT_ASSERT(testObj.someMap.empty());
+    // errors within masked-out members are not reported as they are not converted
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+
+    // nested objects are deserialized completely
+    const vector<string> memberNames{ "testObj" };
+    const auto nestingObj = JsonReflector::fromJson<NestingObject>(
+        "{\"name\":\"nesting\",\"testObj\":" + json + "}", JsonReflector::JsonFieldMask(memberNames.begin(), memberNames.end()), &errors);
+    CPPUNIT_ASSERT_EQUAL(string(), nestingObj.name);
+    CPPUNIT_ASSERT_EQUAL(42, nestingObj.testObj.number);
+    CPPUNIT_ASSERT_EQUAL(true, nestingObj.testObj.boolean);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1, 2, 0 }), nestingObj.testObj.numbers);
+    CPPUNIT_ASSERT_EQUAL(2_st, errors.size());
+
+    // content following the root value is not ignored
+    CPPUNIT_ASSERT_THROW(TestObject::fromJson(json + "{}", { "number" }), RAPIDJSON_NAMESPACE::ParseResult);
+}
+
+/*!
+ * \brief Tests applying JSON merge patches via applyMergePatch().
+ */
+void JsonReflectorTests::testMergePatch()
+{
+    NestingObject nestingObj;
+    nestingObj.name = "nesting";
+    nestingObj.testObj.number = 42;
+    nestingObj.testObj.numbers = { 1, 2, 3 };
+    nestingObj.testObj.text = "test";
+    nestingObj.testObj.boolean = true;
+    nestingObj.testObj.someMap = { { "a", 1 }, { "b", 2 } };
+
+    // update nested members, reset a member via null, replace arrays as a whole, remove/insert map keys
+    JsonDeserializationErrors errors;
+    nestingObj.applyMergePatch(
+        "{\"testObj\":{\"number\":43,\"text\":null,\"numbers\":[4],\"someMap\":{\"a\":null,\"c\":3},\"unknown\":[1]}}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL("nesting"s, nestingObj.name);
+    CPPUNIT_ASSERT_EQUAL(43, nestingObj.testObj.number);
+    CPPUNIT_ASSERT_EQUAL(string(), nestingObj.testObj.text);
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 4 }), nestingObj.testObj.numbers);
+    CPPUNIT_ASSERT_EQUAL(true, nestingObj.testObj.boolean);
+    CPPUNIT_ASSERT_EQUAL(2_st, nestingObj.testObj.someMap.size());
+    CPPUNIT_ASSERT_EQUAL(2, nestingObj.testObj.someMap.at("b"));
+    CPPUNIT_ASSERT_EQUAL(3, nestingObj.testObj.someMap.at("c"));
+
+    // replace multimaps as a whole (they are not patched key by key as their keys are not unique)
+    nestingObj.testObj.someMultimap = { { "a", 1 }, { "a", 2 }, { "b", 3 } };
+    nestingObj.applyMergePatch("{\"testObj\":{\"someMultimap\":{\"a\":[4],\"c\":[5]}}}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    const multimap<string, int> expectedMultiMap{ { "a", 4 }, { "c", 5 } };
+    CPPUNIT_ASSERT_EQUAL(expectedMultiMap, nestingObj.testObj.someMultimap);
+
+    // report type mismatches without touching the affected member
+    JsonReflector::applyMergePatch(nestingObj, "{\"name\":1,\"testObj\":{\"boolean\":false}}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors.front().expectedType);
+    CPPUNIT_ASSERT_EQUAL(JsonType::Number, errors.front().actualType);
+    CPPUNIT_ASSERT_EQUAL("name"s, string(errors.front().member));
+    CPPUNIT_ASSERT_EQUAL("nesting"s, nestingObj.name);
+    CPPUNIT_ASSERT_EQUAL(false, nestingObj.testObj.boolean);
+
+    // reset a nested object as a whole
+    errors.clear();
+    nestingObj.applyMergePatch("{\"testObj\":null}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL("nesting"s, nestingObj.name);
+    CPPUNIT_ASSERT_EQUAL(vector<int>(), nestingObj.testObj.numbers);
+    CPPUNIT_ASSERT(nestingObj.testObj.someMap.empty());
+
+    // content following the patch is not ignored
+    CPPUNIT_ASSERT_THROW(nestingObj.applyMergePatch("{\"name\":\"foo\"}}"s), RAPIDJSON_NAMESPACE::ParseResult);
+}
+
+/*!
+ * \brief Tests passing a JsonPolicy to fromJson() and toJson() to customize the flags used by RapidJSON.
+ */
+void JsonReflectorTests::testPolicies()
+{
+    // parse flags
+    const auto jsonWithComment = "{/* comment */\"number\":42}"s;
+    CPPUNIT_ASSERT_THROW(TestObject::fromJson(jsonWithComment), ParseResult);
+    CPPUNIT_ASSERT_EQUAL(42, TestObject::fromJson<JsonReflector::JsonPolicy<kParseCommentsFlag>>(jsonWithComment).number);
+    using NanAndInf = JsonReflector::JsonPolicy<kParseNanAndInfFlag, kWriteNanAndInfFlag>;
+    CPPUNIT_ASSERT_EQUAL(std::numeric_limits<double>::infinity(), (JsonReflector::fromJson<double, NanAndInf>("Infinity")));
+
+    // parse flags when deserializing without building a document
+    using Comments = JsonReflector::JsonPolicy<kParseCommentsFlag>;
+    CPPUNIT_ASSERT_THROW(TestObject::fromJsonSax(jsonWithComment), ParseResult);
+    CPPUNIT_ASSERT_EQUAL(42, (JsonReflector::fromJsonSax<TestObject, Comments>(jsonWithComment).number));
+    auto insituJsonWithComment = "{\"name\":/* comment */\"insitu\"}"s;
+    CPPUNIT_ASSERT_EQUAL("insitu"s, (JsonReflector::fromJsonInsitu<NestingObject, Comments>(insituJsonWithComment).name));
+    auto patchedObj = TestObject();
+    JsonReflector::applyMergePatch<TestObject, Comments>(patchedObj, jsonWithComment);
+    CPPUNIT_ASSERT_EQUAL(42, patchedObj.number);
+    CPPUNIT_ASSERT_EQUAL(-std::numeric_limits<double>::infinity(),
+        (JsonReflector::fromJsonSax<vector<double>, NanAndInf>("[-Infinity]").at(0)));
+    stringstream linesWithComments("[1] // first\n[2] // second");
+    JsonReflector::JsonLinesReader<vector<int>, Comments> linesReader(linesWithComments);
+    vector<int> line;
+    CPPUNIT_ASSERT(linesReader.read(line));
+    CPPUNIT_ASSERT_EQUAL(vector<int>({ 1 }), line);
+
+    // max decimal places
+    auto testObj = TestObject();
+    testObj.number2 = 3.141592653589793;
+    using TwoDecimalPlaces = JsonReflector::JsonPolicy<kParseDefaultFlags, kWriteDefaultFlags, 2>;
+    const auto json = string(testObj.toJson<TwoDecimalPlaces>().GetString());
+    CPPUNIT_ASSERT(json.find("\"number2\":3.14,") != string::npos);
+    CPPUNIT_ASSERT_EQUAL("[3.14]\n[0.5]\n"s, (JsonReflector::toJsonLines<vector<vector<double>>, TwoDecimalPlaces>({ { 3.14159 }, { 0.5 } }, 2)));
+
+    // write flags (still written directly without building a document)
+    CPPUNIT_ASSERT_EQUAL("NaN"s, string((JsonReflector::toJson<double, NanAndInf>(std::numeric_limits<double>::quiet_NaN()).GetString())));
+    testObj.number2 = -std::numeric_limits<double>::infinity();
+    string out;
+    JsonReflector::toJson<TestObject, NanAndInf>(testObj, out);
+    CPPUNIT_ASSERT(out.find("\"number2\":-Infinity,") != string::npos);
+    CPPUNIT_ASSERT_EQUAL(
+        "[NaN]\n"s, (JsonReflector::toJsonLines<vector<vector<double>>, NanAndInf>({ { std::numeric_limits<double>::quiet_NaN() } })));
+
+    // parse flags and error mode when deserializing in parallel
+    const auto arrayWithComment = "[{\"name\":/* comment */\"a\"},{\"name\":\"b\",\"testObj\":{\"number\":\"1\"}}]"s;
+    JsonDeserializationErrors errors;
+    const auto objects
+        = JsonReflector::fromJsonParallel<vector<NestingObject>, Comments>(arrayWithComment.data(), arrayWithComment.size(), &errors, 2);
+    CPPUNIT_ASSERT_EQUAL(2_st, objects.size());
+    CPPUNIT_ASSERT_EQUAL("b"s, objects[1].name);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    errors.clear();
+    using IgnoreErrorsWithComments = JsonReflector::JsonPolicy<kParseCommentsFlag, kWriteDefaultFlags,
+        RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces, JsonErrorMode::Ignore>;
+    JsonReflector::fromJsonParallel<vector<NestingObject>, IgnoreErrorsWithComments>(arrayWithComment.data(), arrayWithComment.size(), &errors, 2);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    using FailFastWithComments = JsonReflector::JsonPolicy<kParseCommentsFlag, kWriteDefaultFlags,
+        RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces, JsonErrorMode::FailFast>;
+    try {
+        JsonReflector::fromJsonParallel<vector<NestingObject>, FailFastWithComments>(arrayWithComment.data(), arrayWithComment.size(), nullptr, 2);
+        CPPUNIT_FAIL("expected JsonDeserializationFailure thrown");
+    } catch (const JsonDeserializationFailure &failure) {
+        CPPUNIT_ASSERT_EQUAL("/1/testObj/number"s, failure.path);
+    }
+}
+
+/*!
+ * \brief Tests (de)serializing enums marked via REFLECTIVE_RAPIDJSON_SERIALIZE_JSON_ENUM_BY_NAME by name.
+ */
+void JsonReflectorTests::testEnumsByName()
+{
+    // serialization via push() and write()
+    const auto values = vector<SomeNamedEnum>{ SomeNamedEnum::Green, SomeNamedEnum::Blue, static_cast<SomeNamedEnum>(5) };
+    const auto expectedJson = "[\"Green\",\"Blue\",5]"s;
+    CPPUNIT_ASSERT_EQUAL(expectedJson, string(JsonReflector::toJson(values).GetString()));
+    string out;
+    JsonReflector::toJson(values, out);
+    CPPUNIT_ASSERT_EQUAL(expectedJson, out);
+
+    // deserialization via pull() and read() yields the serialized values again
+    JsonDeserializationErrors errors;
+    const auto roundTrippedValues = JsonReflector::fromJson<vector<SomeNamedEnum>>(expectedJson, &errors);
+    CPPUNIT_ASSERT(values == roundTrippedValues);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT(values == JsonReflector::fromJsonSax<vector<SomeNamedEnum>>(expectedJson, &errors));
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+
+    // unknown names and other types are rejected
+    const auto parsedValues = JsonReflector::fromJson<vector<SomeNamedEnum>>("[\"Red\",\"Blue\",\"Purple\",\"Gree\",1,true]"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(6_st, parsedValues.size());
+    CPPUNIT_ASSERT(parsedValues[0] == SomeNamedEnum::Red);
+    CPPUNIT_ASSERT(parsedValues[1] == SomeNamedEnum::Blue);
+    CPPUNIT_ASSERT(parsedValues[4] == SomeNamedEnum::Green);
+    CPPUNIT_ASSERT_EQUAL(3_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors[0].kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors[0].expectedType);
+    CPPUNIT_ASSERT_EQUAL(2_st, errors[0].index);
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors[1].kind);
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors[2].kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors[2].expectedType);
+    CPPUNIT_ASSERT_EQUAL(JsonType::Bool, errors[2].actualType);
+
+    // deserialization via pull()
+    Document doc(kArrayType);
+    doc.Parse(expectedJson.data(), expectedJson.size());
+    auto pulledValues = vector<SomeNamedEnum>();
+    errors.clear();
+    JsonReflector::pull(pulledValues, doc, &errors);
+    CPPUNIT_ASSERT(values == pulledValues);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    doc.Parse("[\"Green\",\"Purple\"]");
+    JsonReflector::pull(pulledValues, doc, &errors);
+    CPPUNIT_ASSERT_EQUAL(2_st, pulledValues.size());
+    CPPUNIT_ASSERT(pulledValues[0] == SomeNamedEnum::Green);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors.front().kind);
+}
+
+/*!
+ * \brief Tests (de)serializing maps with integral and enum keys.
+ */
+void JsonReflectorTests::testMapsWithNonStringKeys()
+{
+    // serialization via push() and write()
+    const auto numbers = map<std::uint64_t, int>{ { 1, 2 }, { numeric_limits<std::uint64_t>::max(), 3 } };
+    const auto expectedNumbersJson = "{\"1\":2,\"18446744073709551615\":3}"s;
+    CPPUNIT_ASSERT_EQUAL(expectedNumbersJson, string(JsonReflector::toJson(numbers).GetString()));
+    auto doc = JsonReflector::toJsonDocument(numbers);
+    CPPUNIT_ASSERT_EQUAL(expectedNumbersJson, string(JsonReflector::serializeJsonDocToString(doc).GetString()));
+    const auto enums = map<SomeNamedEnum, int>{ { SomeNamedEnum::Red, 1 }, { static_cast<SomeNamedEnum>(5), 2 } };
+    CPPUNIT_ASSERT_EQUAL("{\"Red\":1,\"5\":2}"s, string(JsonReflector::toJson(enums).GetString()));
+    const auto multiMap = std::multimap<int, int>{ { -1, 1 }, { -1, 2 }, { 3, 4 } };
+    CPPUNIT_ASSERT_EQUAL("{\"-1\":[1,2],\"3\":[4]}"s, string(JsonReflector::toJson(multiMap).GetString()));
+
+    // delta
+    const auto baseline = map<int, int>{ { 1, 1 }, { 2, 2 }, { 3, 3 } };
+    const auto current = map<int, int>{ { 1, 1 }, { 2, 5 }, { 4, 6 } };
+    doc = Document(kObjectType);
+    auto object = doc.GetObject();
+    JsonReflector::pushDelta(current, baseline, JsonReflector::makeJsonMemberName("m", "\"m\""), object, doc.GetAllocator());
+    CPPUNIT_ASSERT_EQUAL("{\"m\":{\"2\":5,\"4\":6,\"3\":null}}"s, string(JsonReflector::serializeJsonDocToString(doc).GetString()));
+
+    // deserialization via read() and pull()
+    JsonDeserializationErrors errors;
+    const auto parsedNumbers = JsonReflector::fromJson<unordered_map<std::uint64_t, int>>("{\"18446744073709551615\":3,\"1x\":4,\"-1\":5}"s, &errors);
+    CPPUNIT_ASSERT_EQUAL(1_st, parsedNumbers.size());
+    CPPUNIT_ASSERT_EQUAL(3, parsedNumbers.at(numeric_limits<std::uint64_t>::max()));
+    CPPUNIT_ASSERT_EQUAL(2_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::ConversionError, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL(JsonType::String, errors.front().expectedType);
+    doc.Parse("{\"Green\":1,\"5\":2,\"Purple\":3}");
+    auto pulledEnums = map<SomeNamedEnum, int>();
+    errors.clear();
+    JsonReflector::pull(pulledEnums, doc, &errors);
+    CPPUNIT_ASSERT_EQUAL(2_st, pulledEnums.size());
+    CPPUNIT_ASSERT_EQUAL(1, pulledEnums.at(SomeNamedEnum::Green));
+    CPPUNIT_ASSERT_EQUAL(2, pulledEnums.at(static_cast<SomeNamedEnum>(5)));
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+}
+
 /*!
  * \brief Tests whether RAPIDJSON_NAMESPACE::ParseResult is thrown correctly when passing invalid JSON to fromJSON().
  */
@@ -664,3 +1881,67 @@ void JsonReflectorTests::testHandlingTypeMismatch()
     errors.throwOn = JsonDeserializationErrors::ThrowOn::TypeMismatch;
     CPPUNIT_ASSERT_THROW(NestingObject::fromJson("{\"name\":[],\"testObj\":\"this is not an object\"}", &errors), JsonDeserializationError);
 }
+
+/*!
+ * \brief Tests the error modes which can be specified via JsonPolicy.
+ */
+void JsonReflectorTests::testErrorModes()
+{
+    const auto json = "{\"name\":\"nesting2\",\"testObjects\":[{\"number\":42},{\"number\":\"43\",\"text\":\"test\"}]}"s;
+
+    // ignore errors
+    JsonDeserializationErrors errors;
+    const auto ignoringErrors = NestingArray::fromJson<JsonReflector::IgnoreErrorsJsonPolicy>(json, &errors);
+    CPPUNIT_ASSERT_EQUAL(0_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(2_st, ignoringErrors.testObjects.size());
+    CPPUNIT_ASSERT_EQUAL("test"s, ignoringErrors.testObjects[1].text);
+
+    // fail fast on the first error providing its location as JSON pointer
+    try {
+        NestingArray::fromJson<JsonReflector::FailFastJsonPolicy>(json, &errors);
+        CPPUNIT_FAIL("expected JsonDeserializationFailure thrown");
+    } catch (const JsonDeserializationFailure &failure) {
+        CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, failure.kind);
+        CPPUNIT_ASSERT_EQUAL(JsonType::Number, failure.expectedType);
+        CPPUNIT_ASSERT_EQUAL(JsonType::String, failure.actualType);
+        CPPUNIT_ASSERT_EQUAL("/testObjects/1/number"s, failure.path);
+    }
+    try {
+        JsonReflector::fromJson<vector<int>, JsonReflector::FailFastJsonPolicy>("[1,\"2\"]");
+        CPPUNIT_FAIL("expected JsonDeserializationFailure thrown");
+    } catch (const JsonDeserializationFailure &failure) {
+        CPPUNIT_ASSERT_EQUAL("/1"s, failure.path);
+    }
+    CPPUNIT_ASSERT_EQUAL(42, NestingObject::fromJson<JsonReflector::FailFastJsonPolicy>("{\"testObj\":{\"number\":42}}"s).testObj.number);
+    try {
+        NestingArray::fromJson<JsonReflector::FailFastJsonPolicy>("{\"testObjects\":[{},{\"someVariant\":{\"index\":0}},{\"number\":\"1\"}]}");
+        CPPUNIT_FAIL("expected JsonDeserializationFailure thrown");
+    } catch (const JsonDeserializationFailure &failure) {
+        CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::InvalidVariantObject, failure.kind);
+        CPPUNIT_ASSERT_EQUAL("/testObjects/1/someVariant"s, failure.path);
+    }
+
+    // fail fast determining the location with the parse flags of the policy; invalid JSON is still reported as such
+    using FailFastWithComments = JsonReflector::JsonPolicy<kParseCommentsFlag, kWriteDefaultFlags,
+        RAPIDJSON_NAMESPACE::Writer<RAPIDJSON_NAMESPACE::StringBuffer>::kDefaultMaxDecimalPlaces, JsonErrorMode::FailFast>;
+    try {
+        JsonReflector::fromJson<vector<int>, FailFastWithComments>("[1,/* comment */ \"2\", 3]");
+        CPPUNIT_FAIL("expected JsonDeserializationFailure thrown");
+    } catch (const JsonDeserializationFailure &failure) {
+        CPPUNIT_ASSERT_EQUAL("/1"s, failure.path);
+    }
+    CPPUNIT_ASSERT_THROW((JsonReflector::fromJson<vector<int>, JsonReflector::FailFastJsonPolicy>("[1,\"2\",")), ParseResult);
+
+    // the context is only maintained by readers instantiated for JsonErrorMode::Collect
+    static_assert(JsonReflector::JsonReader::tracksErrorContext);
+    static_assert(!JsonReflector::BasicJsonReader<kParseDefaultFlags, JsonErrorMode::FailFast>::tracksErrorContext);
+    JsonReflector::BasicJsonReader<kParseDefaultFlags, JsonErrorMode::Ignore> reader(json.data(), json.size());
+    auto readObj = NestingArray();
+    reader.next();
+    JsonReflector::read(readObj, reader, &errors);
+    CPPUNIT_ASSERT_EQUAL("test"s, readObj.testObjects.at(1).text);
+    CPPUNIT_ASSERT_EQUAL(1_st, errors.size());
+    CPPUNIT_ASSERT_EQUAL(JsonDeserializationErrorKind::TypeMismatch, errors.front().kind);
+    CPPUNIT_ASSERT_EQUAL("[document]"s, string(errors.front().record));
+    CPPUNIT_ASSERT(!errors.front().member);
+}